@@ -0,0 +1,111 @@
+/*
+ * Allocation count benchmark
+ * @file alloc_bench.cpp
+ * Counts heap allocations of MotionEditor::loadFromFile / unload with and
+ * without the pmr arena mode, using a counting global operator new/delete.
+ *
+ * usage: motion_editor_alloc_bench [motion.yaml] [frames]
+ *   motion.yaml : source motion (default: package share test_motion.yaml)
+ *   frames      : source frames are repeated up to this count (default 10000)
+ */
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <new>
+#include "motion_editor/motion_editor.hpp"
+
+using namespace ROBIT_HUMANOID_MOTION_EDITOR;
+
+// ===== 카운팅 할당기 (전역 new/delete 교체) =====
+static std::atomic<long> g_allocs{0};
+static std::atomic<long> g_frees{0};
+
+void* operator new(std::size_t n) {
+  g_allocs.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept {
+  if (!p) return;
+  g_frees.fetch_add(1, std::memory_order_relaxed);
+  std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept { operator delete(p); }
+
+// pmr::new_delete_resource 는 정렬 지정 버전을 사용
+void* operator new(std::size_t n, std::align_val_t al) {
+  g_allocs.fetch_add(1, std::memory_order_relaxed);
+  const std::size_t a = static_cast<std::size_t>(al);
+  if (void* p = std::aligned_alloc(a, ((n ? n : 1) + a - 1) / a * a)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void* p, std::align_val_t) noexcept { operator delete(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { operator delete(p); }
+
+struct Counts {
+  long allocs;
+  long frees;
+};
+static Counts snapshot() { return Counts{g_allocs.load(), g_frees.load()}; }
+
+static void runMode(const std::string& path, bool arena, long yaml_only) {
+  Counts c0 = snapshot();
+  Counts c1{}, c2{};
+  {
+    MotionEditor me;
+    me.setArenaAllocation(arena);
+    me.loadFromFile(path);
+    c1 = snapshot();
+  } // unload
+  c2 = snapshot();
+
+  const long load_allocs = c1.allocs - c0.allocs;
+  const long retained = (c1.allocs - c0.allocs) - (c1.frees - c0.frees);
+  const long unload_frees = c2.frees - c1.frees;
+  std::printf("%-8s load allocs: %9ld  (editor-side: %8ld)  retained blocks: %8ld  unload frees: %8ld\n",
+              arena ? "arena" : "default", load_allocs, load_allocs - yaml_only, retained, unload_frees);
+}
+
+int main(int argc, char** argv)
+{
+  try {
+    std::string src = (argc > 1) ? argv[1]
+      : ament_index_cpp::get_package_share_directory("motion_editor") + "/motion/test_motion.yaml";
+    const std::size_t frames = (argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 10000;
+
+    // 원본 프레임을 반복해 큰 모션 파일 생성
+    const std::string path =
+      (std::filesystem::temp_directory_path() / "motion_editor_alloc_bench.yaml").string();
+    {
+      MotionEditor base;
+      base.loadFromFile(src);
+      MotionEditor big = base;
+      big.clearFrames();
+      for (std::size_t i = 0; base.frameCount() > 0 && i < frames; ++i) {
+        Frame f = base.frameAt(i % base.frameCount());
+        f.name = std::to_string(i);
+        big.appendFrame(std::move(f));
+      }
+      big.saveToFile(path);
+    }
+
+    // YAML 파싱 자체의 할당 수 (편집기와 무관한 몫)
+    Counts y0 = snapshot();
+    { YAML::Node root = YAML::LoadFile(path); }
+    const long yaml_only = snapshot().allocs - y0.allocs;
+
+    std::printf("[alloc_bench] %zu frames, yaml-cpp parse allocs: %ld\n", frames, yaml_only);
+    runMode(path, false, yaml_only);
+    runMode(path, true, yaml_only);
+
+    std::filesystem::remove(path);
+  }
+  catch (const std::exception& e) {
+    std::fprintf(stderr, "ERR: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
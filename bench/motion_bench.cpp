@@ -0,0 +1,220 @@
+/*
+ * Motion editor benchmark suite
+ * @file motion_bench.cpp
+ * Times the public MotionEditor operations on synthetic motions from 10 up to
+ * 1M frames and prints the results as JSON (one object, stable key order).
+ *
+ * usage: motion_editor_bench [--max-frames N] [--joints N] [--meta N]
+ *                            [--seed N] [--out results.json]
+ *   --max-frames : largest size in the 10, 100, ..., 1M ladder (default 100000)
+ *   --joints     : joints per frame (default 19)
+ *   --meta       : extra unknown meta items per file (default 0)
+ *
+ * forwardKinematics runs batch FK over a serial chain built from j0..j5.
+ * smoothPreview runs Savitzky-Golay (11 taps) over every joint column (src -> dst).
+ *
+ * Each op is repeated until ~0.2 s or 50 reps have elapsed (at least once);
+ * min / median / mean are reported in nanoseconds per call.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "motion_editor/joint_groups.hpp"
+#include "motion_editor/kinematics.hpp"
+#include "motion_editor/motion_editor.hpp"
+#include "motion_editor/motion_filters.hpp"
+#include "synthetic_motion.hpp"
+
+using namespace ROBIT_HUMANOID_MOTION_EDITOR;
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+  std::size_t frames;
+  std::string op;
+  std::size_t reps;
+  std::size_t ops_per_rep; // 한 번 측정에 포함된 호출 수
+  double min_ns;
+  double median_ns;
+  double mean_ns;
+};
+
+// fn 을 반복 실행해 호출 1회당 시간(ns) 통계 산출
+static Result measure(std::size_t frames, const std::string& op, std::size_t ops_per_rep,
+                      const std::function<void()>& setup, const std::function<void()>& fn) {
+  std::vector<double> samples;
+  const auto budget = std::chrono::milliseconds(200);
+  const auto t_end = Clock::now() + budget;
+  do {
+    if (setup) setup();
+    const auto t0 = Clock::now();
+    fn();
+    const auto t1 = Clock::now();
+    samples.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / (double)ops_per_rep);
+  } while (samples.size() < 50 && Clock::now() < t_end);
+
+  std::sort(samples.begin(), samples.end());
+  double sum = 0.0;
+  for (double s : samples) sum += s;
+  return Result{frames, op, samples.size(), ops_per_rep,
+                samples.front(), samples[samples.size() / 2], sum / (double)samples.size()};
+}
+
+static void benchSize(const SyntheticMotionSpec& spec, const std::string& dir, std::vector<Result>& out) {
+  const std::string path = dir + "/bench_" + std::to_string(spec.frames) + ".yaml";
+  const std::string save_path = dir + "/bench_" + std::to_string(spec.frames) + "_out.yaml";
+  writeSyntheticMotion(path, spec);
+
+  const auto joint_map = syntheticJointMap(spec.joints);
+  const std::size_t n = spec.frames;
+
+  // 1) load / save
+  out.push_back(measure(n, "load", 1, nullptr, [&] {
+    MotionEditor me(joint_map);
+    me.loadFromFile(path);
+  }));
+
+  MotionEditor me(joint_map);
+  me.loadFromFile(path);
+  out.push_back(measure(n, "save", 1, nullptr, [&] { me.saveToFile(save_path); }));
+
+  // 2) 조회: 결정적 난수로 고른 스텝 이름 (모두 존재)
+  const std::size_t lookups = std::clamp<std::size_t>(10'000'000 / n, 16, 1000);
+  std::vector<std::string> steps;
+  SyntheticRng rng{spec.seed ^ 0x5eed};
+  for (std::size_t k = 0; k < lookups; ++k) steps.push_back(std::to_string(rng.next() % n));
+
+  out.push_back(measure(n, "getFrame", lookups, nullptr, [&] {
+    for (const auto& s : steps) {
+      auto f = me.getFrame(s);
+      if (!f) std::abort();
+    }
+  }));
+
+  out.push_back(measure(n, "listStepNames", 1, nullptr, [&] {
+    auto names = me.listStepNames();
+    if (names.size() != n) std::abort();
+  }));
+
+  // 3) 단일 스텝 편집 (관절 4개)
+  std::vector<JointPosMap> edits(lookups);
+  for (auto& q : edits) {
+    for (int k = 0; k < 4; ++k) q["j" + std::to_string(rng.next() % spec.joints)] = rng.uniform(-1.0, 1.0);
+  }
+  out.push_back(measure(n, "editJoints", lookups, nullptr, [&] {
+    for (std::size_t k = 0; k < lookups; ++k) me.editJoints(steps[k], edits[k], true);
+  }));
+
+  // 4) 일괄 편집: 전 관절 그룹을 전체 프레임에 오프셋 (공유 해제 비용 포함되도록 매번 복제본에서)
+  JointGroupSet groups;
+  std::vector<std::string> all;
+  for (int j = 0; j < spec.joints; ++j) all.push_back("j" + std::to_string(j));
+  groups.addGroup("all", all, me);
+
+  MotionEditor work(me);
+  out.push_back(measure(n, "batchOffset", 1, [&] { work = me; }, [&] {
+    JointGroupEditor(work, groups.at("all")).offsetAll(0.001);
+  }));
+  out.push_back(measure(n, "batchOffsetInPlace", 1, nullptr, [&] {
+    JointGroupEditor(work, groups.at("all")).offsetAll(0.001);
+  }));
+
+  // 5) 전 프레임 FK: j0 부터 이어지는 직렬 체인 (최대 6관절), 끝점 1개
+  KinematicChain chain;
+  std::string parent;
+  for (int j = 0; j < std::min(spec.joints, 6); ++j) {
+    const std::string name = "j" + std::to_string(j);
+    chain.addLink(name, j, parent, Vec3{(double)(j % 3 == 0), (double)(j % 3 == 1), (double)(j % 3 == 2)},
+                  Vec3{0.0, 0.0, 0.1});
+    parent = name;
+  }
+  chain.addEndEffector("tip", parent, Vec3{0.0, 0.0, 0.1});
+  ForwardKinematics fk(chain);
+  out.push_back(measure(n, "forwardKinematics", 1, nullptr, [&] {
+    auto traj = fk.run(me);
+    if (traj[0].x.size() != n) std::abort();
+  }));
+
+  // 6) 평활 미리보기: 추출해 둔 열에서 복사본 열로 전 프레임 Savitzky-Golay
+  const JointColumns cols = JointColumns::extractAll(me);
+  JointColumns preview = cols;
+  SmoothingOptions sg;
+  sg.kind = SmoothingKind::SavitzkyGolay;
+  sg.half_window = 5;
+  sg.poly_order = 3;
+  const MotionSmoother smoother(sg);
+  out.push_back(measure(n, "smoothPreview", 1, nullptr, [&] { smoother.apply(cols, preview, 0, n); }));
+
+  std::filesystem::remove(path);
+  std::filesystem::remove(save_path);
+}
+
+static void printJson(std::FILE* fp, const SyntheticMotionSpec& spec, const std::vector<Result>& results) {
+  std::fprintf(fp, "{\n  \"benchmark\": \"motion_editor_bench\",\n");
+  std::fprintf(fp, "  \"joints\": %d,\n  \"meta_items\": %zu,\n  \"seed\": %llu,\n",
+               spec.joints, spec.meta_items, (unsigned long long)spec.seed);
+  std::fprintf(fp, "  \"results\": [\n");
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const Result& r = results[i];
+    std::fprintf(fp,
+                 "    {\"frames\": %zu, \"op\": \"%s\", \"reps\": %zu, \"ops_per_rep\": %zu, "
+                 "\"min_ns\": %.1f, \"median_ns\": %.1f, \"mean_ns\": %.1f}%s\n",
+                 r.frames, r.op.c_str(), r.reps, r.ops_per_rep, r.min_ns, r.median_ns, r.mean_ns,
+                 i + 1 < results.size() ? "," : "");
+  }
+  std::fprintf(fp, "  ]\n}\n");
+}
+
+int main(int argc, char** argv)
+{
+  SyntheticMotionSpec spec;
+  std::size_t max_frames = 100000;
+  std::string out_path;
+
+  for (int i = 1; i < argc; ++i) {
+    const bool has_value = i + 1 < argc;
+    if (!std::strcmp(argv[i], "--max-frames") && has_value) max_frames = std::strtoul(argv[++i], nullptr, 10);
+    else if (!std::strcmp(argv[i], "--joints") && has_value) spec.joints = std::atoi(argv[++i]);
+    else if (!std::strcmp(argv[i], "--meta") && has_value) spec.meta_items = std::strtoul(argv[++i], nullptr, 10);
+    else if (!std::strcmp(argv[i], "--seed") && has_value) spec.seed = std::strtoull(argv[++i], nullptr, 10);
+    else if (!std::strcmp(argv[i], "--out") && has_value) out_path = argv[++i];
+    else {
+      std::fprintf(stderr, "usage: %s [--max-frames N] [--joints N] [--meta N] [--seed N] [--out file]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (spec.joints <= 0) {
+    std::fprintf(stderr, "ERR: --joints must be positive\n");
+    return 2;
+  }
+
+  try {
+    const auto dir = std::filesystem::temp_directory_path() / "motion_editor_bench";
+    std::filesystem::create_directories(dir);
+
+    std::vector<Result> results;
+    for (std::size_t frames = 10; frames <= max_frames && frames <= 1'000'000; frames *= 10) {
+      std::fprintf(stderr, "[bench] %zu frames...\n", frames);
+      spec.frames = frames;
+      benchSize(spec, dir.string(), results);
+    }
+    std::filesystem::remove_all(dir);
+
+    std::FILE* fp = out_path.empty() ? stdout : std::fopen(out_path.c_str(), "w");
+    if (!fp) throw std::runtime_error("cannot open output: " + out_path);
+    printJson(fp, spec, results);
+    if (fp != stdout) std::fclose(fp);
+  }
+  catch (const std::exception& e) {
+    std::fprintf(stderr, "ERR: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Synthetic motion generator
+ * @file synthetic_motion.hpp
+ * Deterministic motion YAML files of arbitrary size for benchmarks.
+ *
+ * Key features:
+ * - Same spec + seed -> byte-identical file
+ * - Joints are named j0..j{N-1} with motor ids 0..N-1 (see syntheticJointMap)
+ * - Written as text directly (no yaml-cpp node building) so 1M frames stay cheap
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct SyntheticMotionSpec {
+  std::size_t frames = 1000;
+  int joints = 19;
+  std::size_t meta_items = 0;   // name/motor id/type 외 추가 메타 항목 수
+  std::uint64_t seed = 1;
+};
+
+// splitmix64: 플랫폼/표준 라이브러리와 무관하게 같은 수열
+struct SyntheticRng {
+  std::uint64_t s;
+  std::uint64_t next() {
+    std::uint64_t z = (s += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+  double uniform(double lo, double hi) { return lo + (hi - lo) * (double)(next() >> 11) * 0x1.0p-53; }
+};
+
+inline std::unordered_map<std::string, int> syntheticJointMap(int joints) {
+  std::unordered_map<std::string, int> m;
+  for (int j = 0; j < joints; ++j) m["j" + std::to_string(j)] = j;
+  return m;
+}
+
+inline void writeSyntheticMotion(const std::string& path, const SyntheticMotionSpec& spec) {
+  std::FILE* fp = std::fopen(path.c_str(), "w");
+  if (!fp) throw std::runtime_error("writeSyntheticMotion: cannot open file: " + path);
+
+  SyntheticRng rng{spec.seed};
+  std::fprintf(fp, "- name: synthetic\n- motor id:\n");
+  for (int j = 0; j < spec.joints; ++j) std::fprintf(fp, "    - %d\n", j);
+  std::fprintf(fp, "- type: motion\n");
+  for (std::size_t k = 0; k < spec.meta_items; ++k) {
+    std::fprintf(fp, "- note_%zu: \"synthetic meta item %zu\"\n", k, k);
+  }
+
+  // 관절별 랜덤 워크 (실제 모션처럼 프레임 간 값이 연속적)
+  std::vector<double> pos(spec.joints);
+  for (int j = 0; j < spec.joints; ++j) pos[j] = rng.uniform(-1.0, 1.0);
+
+  for (std::size_t i = 0; i < spec.frames; ++i) {
+    std::fprintf(fp, "- time: %d\n  delay: %d\n  repeat: 0\n  name: %zu\n  selected: false\n  dxl:\n",
+                 20 + (int)(rng.next() % 200), (int)(rng.next() % 4) * 10, i);
+    for (int j = 0; j < spec.joints; ++j) {
+      pos[j] += rng.uniform(-0.02, 0.02);
+      std::fprintf(fp, "    - id: %d\n      position: %.6f\n", j, pos[j]);
+    }
+  }
+  std::fclose(fp);
+}
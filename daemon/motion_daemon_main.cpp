@@ -0,0 +1,77 @@
+/*
+ * Motion daemon executable
+ * @file motion_daemon_main.cpp
+ * Loads every motion YAML in a directory into a MotionLibrary and serves it
+ * over a Unix domain socket until SIGINT / SIGTERM.
+ *
+ * usage: motion_editor_daemon [--dir DIR] [--socket PATH] [--no-watch]
+ *   --dir      : motion directory (default <share>/motion_editor/motion)
+ *   --socket   : socket path (default /tmp/motion_editor.sock)
+ *   --no-watch : do not hot-reload files changed by other programs
+ */
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <pthread.h>
+#include <string>
+
+#include "motion_editor/motion_daemon.hpp"
+#include "motion_editor/motion_library.hpp"
+
+using namespace ROBIT_HUMANOID_MOTION_EDITOR;
+
+int main(int argc, char** argv)
+{
+  std::string dir;
+  DaemonOptions opt;
+  opt.socket_path = "/tmp/motion_editor.sock";
+  bool watch = true;
+
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--dir" && i + 1 < argc) {
+      dir = argv[++i];
+    } else if (a == "--socket" && i + 1 < argc) {
+      opt.socket_path = argv[++i];
+    } else if (a == "--no-watch") {
+      watch = false;
+    } else {
+      std::cerr << "usage: " << argv[0] << " [--dir DIR] [--socket PATH] [--no-watch]\n";
+      return 2;
+    }
+  }
+
+  try {
+    if (dir.empty()) dir = ament_index_cpp::get_package_share_directory("motion_editor") + "/motion";
+
+    // 종료 시그널은 sigwait 로 받음 (데몬/감시 스레드에는 전달되지 않도록 먼저 막음)
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sigs, nullptr);
+
+    MotionLibrary lib;
+    const std::size_t n = lib.loadDirectory(dir);
+    MotionDaemon daemon(lib, opt);
+    daemon.start();
+    if (watch) lib.startWatching();
+    std::cout << "[motion_daemon] " << n << " motions from " << dir << ", listening on " << opt.socket_path << std::endl;
+
+    int sig = 0;
+    sigwait(&sigs, &sig);
+
+    lib.stopWatching();
+    daemon.stop();
+    const DaemonStats st = daemon.stats();
+    std::cout << "[motion_daemon] stopped (" << st.requests << " requests in " << st.batches << " batches, "
+              << st.publishes << " publishes)\n";
+  }
+  catch (const std::exception& e) {
+    std::cerr << "ERR: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
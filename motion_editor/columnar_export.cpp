@@ -0,0 +1,241 @@
+/*
+ * Columnar Export
+ * @file columnar_export.cpp
+ * Single pass over the frames in blocks: each block is transposed into per-column
+ * buffers and written with pwrite at the column's offset, so the cost is the
+ * frame walk plus large sequential writes (no text formatting).
+ */
+
+#include "motion_editor/columnar_export.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+constexpr char kMagic[8] = {'M', 'E', 'C', 'O', 'L', 'S', '0', '1'};
+constexpr std::size_t kAlign = 64;
+constexpr std::size_t kBlock = 8192; // 블록당 프레임 수
+
+std::size_t alignUp(std::size_t v) { return (v + kAlign - 1) / kAlign * kAlign; }
+
+void appendJsonString(std::string& out, const std::string& s) {
+  out += '"';
+  for (unsigned char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += (char)c;
+    } else if (c < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof buf, "\\u%04x", c);
+      out += buf;
+    } else {
+      out += (char)c; // UTF-8 그대로
+    }
+  }
+  out += '"';
+}
+
+struct Column {
+  std::string name;
+  std::string dtype;
+  std::size_t item{0};   // 원소 크기
+  std::size_t offset{0};
+  int motor_id{-1};
+};
+
+class FileWriter {
+public:
+  explicit FileWriter(const std::string& path)
+  : path_(path), fd_(::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644)) {
+    if (fd_ < 0) throw std::runtime_error("exportColumnar: cannot open file to write: " + path);
+  }
+  ~FileWriter() { if (fd_ >= 0) ::close(fd_); }
+
+  void write(const void* data, std::size_t n, std::size_t offset) {
+    const char* p = static_cast<const char*>(data);
+    while (n) {
+      const ssize_t w = ::pwrite(fd_, p, n, (off_t)offset);
+      if (w < 0) {
+        if (errno == EINTR) continue;
+        throw std::runtime_error("exportColumnar: write failed: " + path_ + ": " + std::strerror(errno));
+      }
+      p += w;
+      n -= (std::size_t)w;
+      offset += (std::size_t)w;
+    }
+  }
+
+  void finish(std::size_t size) {
+    // 마지막 열이 블록 경계에서 끝나지 않아도 파일 크기가 선언과 맞도록
+    if (::ftruncate(fd_, (off_t)size) != 0 || ::close(fd_) != 0) {
+      fd_ = -1;
+      throw std::runtime_error("exportColumnar: write failed: " + path_);
+    }
+    fd_ = -1;
+  }
+
+private:
+  std::string path_;
+  int fd_;
+};
+} // namespace
+
+ColumnarExportStats exportColumnar(const MotionEditor& me, const std::string& path,
+                                   const std::string& motion_name) {
+  // 비소유 shared_ptr (호출 중에만 사용)
+  std::shared_ptr<const MotionEditor> ref(std::shared_ptr<const MotionEditor>{}, &me);
+  return exportColumnar({{motion_name.empty() ? me.motionName() : motion_name, ref}}, path);
+}
+
+ColumnarExportStats exportColumnar(const MotionLibrary& lib, const std::string& path) {
+  std::vector<std::pair<std::string, std::shared_ptr<const MotionEditor>>> motions;
+  for (const auto& name : lib.names()) {
+    if (auto m = lib.get(name)) motions.emplace_back(name, std::move(m)); // 그사이 제거된 모션은 건너뜀
+  }
+  return exportColumnar(motions, path);
+}
+
+ColumnarExportStats exportColumnar(
+  const std::vector<std::pair<std::string, std::shared_ptr<const MotionEditor>>>& motions,
+  const std::string& path) {
+  // 1) 사전 훑기: 전체 프레임 수, 관절 ID 합집합 (등장 순), 이름 최대 길이
+  std::size_t N = 0, name_width = 1;
+  std::vector<int> ids;
+  std::vector<int> id_col; // 모터ID -> 관절 열 (-1 = 없음)
+  for (const auto& [mname, m] : motions) {
+    if (!m) throw std::runtime_error("exportColumnar: null motion: " + mname);
+    N += m->frameCount();
+    for (std::size_t i = 0; i < m->frameCount(); ++i) {
+      const Frame& f = m->frameAt(i);
+      name_width = std::max(name_width, f.name.size());
+      for (const auto& dv : f.dxl) {
+        if (dv.id < 0) throw std::runtime_error("exportColumnar: negative motor id in " + mname);
+        if ((std::size_t)dv.id >= id_col.size()) id_col.resize(dv.id + 1, -1);
+        if (id_col[dv.id] < 0) {
+          id_col[dv.id] = (int)ids.size();
+          ids.push_back(dv.id);
+        }
+      }
+    }
+  }
+
+  // 2) 열 배치
+  std::vector<Column> cols = {
+    {"time", "<i4", 4}, {"delay", "<i4", 4}, {"repeat", "<i4", 4}, {"selected", "|u1", 1},
+    {"motion", "<i4", 4}, {"name", "|S" + std::to_string(name_width), name_width},
+  };
+  constexpr std::size_t kFirstJoint = 6;
+  std::vector<std::string> id_name(id_col.size());
+  if (!motions.empty()) {
+    for (const auto& [jname, id] : motions.front().second->jointToId()) {
+      if (id >= 0 && (std::size_t)id < id_name.size()) id_name[id] = jname;
+    }
+  }
+  for (int id : ids) {
+    Column c{id_name[id].empty() ? "id" + std::to_string(id) : id_name[id], "<f8", 8};
+    c.motor_id = id;
+    cols.push_back(std::move(c));
+  }
+
+  // 헤더 길이가 오프셋에 의존하므로 데이터 시작 위치가 헤더를 담을 때까지 반복 (단조 증가)
+  std::string header;
+  std::size_t data_start = 0;
+  for (;;) {
+    std::size_t off = data_start;
+    for (auto& c : cols) {
+      c.offset = off;
+      off = alignUp(off + c.item * N);
+    }
+
+    header = "{\"frames\": " + std::to_string(N) + ", \"motions\": [";
+    std::size_t first = 0;
+    for (std::size_t k = 0; k < motions.size(); ++k) {
+      header += k ? ", {\"name\": " : "{\"name\": ";
+      appendJsonString(header, motions[k].first);
+      header += ", \"first_frame\": " + std::to_string(first) +
+                ", \"frames\": " + std::to_string(motions[k].second->frameCount()) + "}";
+      first += motions[k].second->frameCount();
+    }
+    header += "], \"columns\": [";
+    for (std::size_t k = 0; k < cols.size(); ++k) {
+      const Column& c = cols[k];
+      header += k ? ", {\"name\": " : "{\"name\": ";
+      appendJsonString(header, c.name);
+      header += ", \"dtype\": \"" + c.dtype + "\", \"offset\": " + std::to_string(c.offset) +
+                ", \"shape\": [" + std::to_string(N) + "]";
+      if (c.motor_id >= 0) header += ", \"motor_id\": " + std::to_string(c.motor_id);
+      header += "}";
+    }
+    header += "]}";
+
+    const std::size_t start = alignUp(sizeof kMagic + 4 + header.size());
+    if (start <= data_start) break;
+    data_start = start;
+  }
+  header.resize(data_start - sizeof kMagic - 4, ' ');
+  std::size_t file_size = data_start;
+  for (const auto& c : cols) file_size = std::max(file_size, c.offset + c.item * N);
+
+  FileWriter out(path);
+  const std::uint32_t hlen = (std::uint32_t)header.size();
+  out.write(kMagic, sizeof kMagic, 0);
+  out.write(&hlen, sizeof hlen, sizeof kMagic);
+  out.write(header.data(), header.size(), sizeof kMagic + sizeof hlen);
+
+  // 3) 블록 단위 전치 + 열별 기록
+  std::vector<std::int32_t> time(kBlock), delay(kBlock), repeat(kBlock), motion(kBlock);
+  std::vector<std::uint8_t> selected(kBlock);
+  std::vector<char> names(kBlock * name_width);
+  std::vector<double> q(kBlock * ids.size()); // 관절 우선: q[j * kBlock + r]
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+
+  std::size_t row = 0; // 다음 블록의 전역 프레임 인덱스
+  std::size_t r = 0;   // 블록 안 행
+  auto flush = [&] {
+    if (!r) return;
+    out.write(time.data(), r * 4, cols[0].offset + row * 4);
+    out.write(delay.data(), r * 4, cols[1].offset + row * 4);
+    out.write(repeat.data(), r * 4, cols[2].offset + row * 4);
+    out.write(selected.data(), r, cols[3].offset + row);
+    out.write(motion.data(), r * 4, cols[4].offset + row * 4);
+    out.write(names.data(), r * name_width, cols[5].offset + row * name_width);
+    for (std::size_t j = 0; j < ids.size(); ++j) {
+      out.write(q.data() + j * kBlock, r * 8, cols[kFirstJoint + j].offset + row * 8);
+    }
+    row += r;
+    r = 0;
+  };
+
+  for (std::size_t mi = 0; mi < motions.size(); ++mi) {
+    const MotionEditor& m = *motions[mi].second;
+    for (std::size_t i = 0; i < m.frameCount(); ++i) {
+      const Frame& f = m.frameAt(i);
+      time[r] = f.time;
+      delay[r] = f.delay;
+      repeat[r] = f.repeat;
+      selected[r] = m.isSelected(i) ? 1 : 0;
+      motion[r] = (std::int32_t)mi;
+      char* nm = names.data() + r * name_width;
+      std::memset(nm, 0, name_width);
+      std::memcpy(nm, f.name.data(), f.name.size());
+      for (std::size_t j = 0; j < ids.size(); ++j) q[j * kBlock + r] = nan;
+      for (const auto& dv : f.dxl) q[id_col[dv.id] * kBlock + r] = dv.position;
+      if (++r == kBlock) flush();
+    }
+  }
+  flush();
+  out.finish(file_size);
+
+  return ColumnarExportStats{motions.size(), N, ids.size(), file_size};
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
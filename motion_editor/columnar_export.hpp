@@ -0,0 +1,53 @@
+/*
+ * Columnar Export
+ * @file columnar_export.hpp
+ * Writes a motion or a whole library as one columnar file for offline analysis
+ * (numpy / pandas), instead of a YAML dump.
+ *
+ * File layout (little-endian):
+ *   8 bytes  "MECOLS01"
+ *   u32      JSON header length (bytes, space padded so data starts 64-byte aligned)
+ *   JSON     {"frames": N, "motions": [{"name", "first_frame", "frames"}...],
+ *             "columns": [{"name", "dtype", "offset", "shape", ["motor_id"]}...]}
+ *   columns  each 64-byte aligned, contiguous, N elements:
+ *            time <i4, delay <i4, repeat <i4, selected |u1, motion <i4 (index into
+ *            "motions"), name |S<w>, then one <f8 column per joint (NaN = not in frame)
+ *
+ * numpy:
+ *   with open(p, "rb") as f:
+ *       f.read(8); n = int.from_bytes(f.read(4), "little"); h = json.loads(f.read(n))
+ *   cols = {c["name"]: np.memmap(p, dtype=c["dtype"], mode="r", offset=c["offset"],
+ *                                shape=tuple(c["shape"])) for c in h["columns"]}
+ *   df = pandas.DataFrame(cols)
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+#include "motion_editor/motion_library.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct ColumnarExportStats {
+  std::size_t motions{0};
+  std::size_t frames{0};
+  std::size_t joints{0};
+  std::size_t bytes{0}; // 파일 크기
+};
+
+// 관절 열 이름은 첫 모션의 매핑(jointToId)으로 역조회, 없으면 "id<모터ID>"
+ColumnarExportStats exportColumnar(const MotionEditor& me, const std::string& path,
+                                   const std::string& motion_name = {});
+// 라이브러리 전체 (이름순, 호출 시점 스냅샷)
+ColumnarExportStats exportColumnar(const MotionLibrary& lib, const std::string& path);
+// (모션 이름, 모션) 목록을 순서대로 이어서 기록
+ColumnarExportStats exportColumnar(
+  const std::vector<std::pair<std::string, std::shared_ptr<const MotionEditor>>>& motions,
+  const std::string& path);
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
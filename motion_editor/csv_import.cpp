@@ -0,0 +1,308 @@
+/*
+ * CSV Import
+ * @file csv_import.cpp
+ * Chunked CSV reader and the streaming keyframe extractor.
+ *
+ * Tolerance mode (per joint, anchor = last emitted keyframe (t0, q0)):
+ *   A later sample j can be the next keyframe iff the line anchor -> j passes
+ *   within tol of every sample i in between, i.e. its slope lies in
+ *     [max_i (q_i - tol - q0) / (t_i - t0),  min_i (q_i + tol - q0) / (t_i - t0)]
+ *   Only these two bounds are kept. When sample j falls outside them, the
+ *   previous sample (which was valid when it arrived) becomes the keyframe.
+ */
+
+#include "motion_editor/csv_import.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+constexpr std::size_t kReadChunk = std::size_t(1) << 20; // 읽기 버퍼 초기 크기 (긴 행이면 늘어남)
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+std::string_view trim(std::string_view s) {
+  while (!s.empty() && (s.front() == ' ' || s.front() == '\t' || s.front() == '"')) s.remove_prefix(1);
+  while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '"' || s.back() == '\r')) s.remove_suffix(1);
+  return s;
+}
+
+bool parseDouble(std::string_view s, double& out) {
+  s = trim(s);
+  if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+  if (s.empty()) return false;
+  const auto r = std::from_chars(s.data(), s.data() + s.size(), out);
+  return r.ec == std::errc() && r.ptr == s.data() + s.size();
+}
+
+// 구분자로 나눈 필드마다 fn(index, field) 호출
+template <class Fn>
+void forEachField(std::string_view line, char delim, Fn&& fn) {
+  std::size_t c = 0;
+  for (;;) {
+    const std::size_t p = line.find(delim);
+    fn(c++, line.substr(0, p));
+    if (p == std::string_view::npos) break;
+    line.remove_prefix(p + 1);
+  }
+}
+
+class KeyframeExtractor {
+public:
+  KeyframeExtractor(const CsvImportOptions& opt, const std::vector<int>& ids,
+                    const CsvMotionImporter::FrameSink& sink, std::size_t& frames)
+  : opt_(opt), ids_(ids), sink_(sink), frames_(frames),
+    anchor_q_(ids.size()), prev_q_(ids.size()), lo_(ids.size()), hi_(ids.size()) {}
+
+  void push(double t, const double* q) {
+    switch (opt_.mode) {
+      case KeyframeMode::All:
+        emit(t, q);
+        return;
+      case KeyframeMode::Decimate:
+        if (rows_++ % std::max<std::size_t>(opt_.stride, 1) == 0) {
+          emit(t, q);
+          pending_ = false;
+        } else {
+          keep(t, q);
+        }
+        return;
+      case KeyframeMode::Tolerance:
+        pushTolerance(t, q);
+        return;
+    }
+  }
+
+  // 마지막 샘플은 항상 키프레임
+  void finish() {
+    if (pending_) emit(prev_t_, prev_q_.data());
+    pending_ = false;
+  }
+
+private:
+  void pushTolerance(double t, const double* q) {
+    if (!anchored_) {
+      emit(t, q);
+      setAnchor(t, q);
+      return;
+    }
+
+    double dt = t - anchor_t_;
+    bool ok = !(opt_.max_interval_sec > 0.0 && dt > opt_.max_interval_sec);
+    for (std::size_t j = 0; ok && j < ids_.size(); ++j) {
+      const double s = (q[j] - anchor_q_[j]) / dt;
+      ok = s >= lo_[j] && s <= hi_[j];
+    }
+    if (!ok) {
+      if (!pending_) {
+        // 앵커 바로 다음 샘플인데도 간격 초과: 이 샘플을 바로 키프레임으로
+        emit(t, q);
+        setAnchor(t, q);
+        return;
+      }
+      emit(prev_t_, prev_q_.data());
+      setAnchor(prev_t_, prev_q_.data());
+      dt = t - anchor_t_;
+    }
+
+    // 이후 후보 끝점이 지켜야 할 이 샘플의 기울기 구간
+    for (std::size_t j = 0; j < ids_.size(); ++j) {
+      lo_[j] = std::max(lo_[j], (q[j] - opt_.tolerance - anchor_q_[j]) / dt);
+      hi_[j] = std::min(hi_[j], (q[j] + opt_.tolerance - anchor_q_[j]) / dt);
+    }
+    keep(t, q);
+  }
+
+  void setAnchor(double t, const double* q) {
+    anchored_ = true;
+    anchor_t_ = t;
+    std::copy(q, q + ids_.size(), anchor_q_.begin());
+    std::fill(lo_.begin(), lo_.end(), -kInf);
+    std::fill(hi_.begin(), hi_.end(), kInf);
+    pending_ = false;
+  }
+
+  void keep(double t, const double* q) {
+    prev_t_ = t;
+    std::copy(q, q + ids_.size(), prev_q_.begin());
+    pending_ = true;
+  }
+
+  void emit(double t, const double* q) {
+    // 반올림 오차가 쌓이지 않도록 첫 샘플 기준 절대 tick 에서 차이를 구함
+    if (!started_) {
+      started_ = true;
+      t_first_ = t;
+    }
+    const long long ticks = std::llround((t - t_first_) / opt_.tick_sec);
+
+    Frame f;
+    f.time = (int)(ticks - last_ticks_);
+    f.name = std::to_string(frames_);
+    f.dxl.reserve(ids_.size());
+    for (std::size_t j = 0; j < ids_.size(); ++j) f.dxl.push_back(DxlValue{ids_[j], q[j]});
+    last_ticks_ = ticks;
+    ++frames_;
+    sink_(std::move(f));
+  }
+
+  const CsvImportOptions& opt_;
+  const std::vector<int>& ids_;
+  const CsvMotionImporter::FrameSink& sink_;
+  std::size_t& frames_;
+
+  bool started_{false};
+  double t_first_{0.0};
+  long long last_ticks_{0};
+  std::size_t rows_{0};
+
+  bool anchored_{false};
+  double anchor_t_{0.0};
+  std::vector<double> anchor_q_;
+  bool pending_{false}; // prev_ 가 아직 내보내지 않은 유효한 후보인지
+  double prev_t_{0.0};
+  std::vector<double> prev_q_;
+  std::vector<double> lo_, hi_;
+};
+} // namespace
+
+CsvMotionImporter::CsvMotionImporter(const MotionEditor& me, const CsvImportOptions& opt)
+: me_(me), opt_(opt) {
+  if (!(opt_.tick_sec > 0.0)) throw std::runtime_error("CsvMotionImporter: tick_sec must be positive");
+  if (opt_.tolerance < 0.0) throw std::runtime_error("CsvMotionImporter: tolerance must be >= 0");
+  if (opt_.delimiter == '\n' || opt_.delimiter == '\r') throw std::runtime_error("CsvMotionImporter: invalid delimiter");
+}
+
+CsvImportStats CsvMotionImporter::run(const std::string& path, const FrameSink& sink) const {
+  std::unique_ptr<std::FILE, int (*)(std::FILE*)> fp(std::fopen(path.c_str(), "rb"), &std::fclose);
+  if (!fp) throw std::runtime_error("CsvMotionImporter: cannot open file: " + path);
+
+  CsvImportStats stats;
+  std::vector<int> ids;            // 관절 열 순서의 모터ID
+  std::vector<int> slot;           // 열 -> 관절 슬롯 (-1 = 무시)
+  long time_col = -1;
+  bool header = true;
+  std::vector<double> q;
+  std::vector<char> seen;          // 슬롯별로 유효한 값을 한 번이라도 읽었는지
+  std::size_t unseen = 0;
+  double last_t = -kInf;
+  std::unique_ptr<KeyframeExtractor> kf;
+
+  auto onHeader = [&](std::string_view line) {
+    forEachField(line, opt_.delimiter, [&](std::size_t c, std::string_view field) {
+      const std::string name(trim(field));
+      slot.push_back(-1);
+      if (name == opt_.time_column) {
+        time_col = (long)c;
+        return;
+      }
+      const int id = me_.jointId(name);
+      if (id < 0) {
+        if (opt_.strict_columns) throw std::runtime_error("CsvMotionImporter: unknown column: " + name);
+        return;
+      }
+      if (std::find(ids.begin(), ids.end(), id) != ids.end()) {
+        throw std::runtime_error("CsvMotionImporter: joint mapped twice: " + name);
+      }
+      slot[c] = (int)ids.size();
+      ids.push_back(id);
+    });
+    if (time_col < 0) throw std::runtime_error("CsvMotionImporter: no '" + opt_.time_column + "' column: " + path);
+    if (ids.empty()) throw std::runtime_error("CsvMotionImporter: no joint columns: " + path);
+    q.assign(ids.size(), 0.0);
+    seen.assign(ids.size(), 0);
+    unseen = ids.size();
+    stats.joints = ids.size();
+    kf = std::make_unique<KeyframeExtractor>(opt_, ids, sink, stats.frames);
+  };
+
+  auto onRow = [&](std::string_view line) {
+    ++stats.rows;
+    double t = 0.0;
+    bool has_t = false;
+    forEachField(line, opt_.delimiter, [&](std::size_t c, std::string_view field) {
+      if ((long)c == time_col) {
+        has_t = parseDouble(field, t);
+      } else if (c < slot.size() && slot[c] >= 0) {
+        // 빈 칸/잘못된 값은 직전 값 유지
+        double v;
+        if (parseDouble(field, v)) {
+          q[slot[c]] = v * opt_.position_scale;
+          if (!seen[slot[c]]) {
+            seen[slot[c]] = 1;
+            --unseen;
+          }
+        }
+      }
+    });
+    t *= opt_.time_scale;
+    // 유지할 직전 값이 없는 관절이 남아 있으면 0 rad 를 자세로 내보내지 않도록 건너뜀
+    if (!has_t || !(t > last_t) || unseen > 0) {
+      ++stats.skipped_rows;
+      return;
+    }
+    last_t = t;
+    kf->push(t, q.data());
+  };
+
+  auto onLine = [&](std::string_view line) {
+    if (trim(line).empty()) return;
+    if (header) {
+      header = false;
+      onHeader(line);
+    } else {
+      onRow(line);
+    }
+  };
+
+  // 고정 크기 버퍼에 청크 단위로 읽고, 잘린 마지막 행은 앞으로 옮겨 다음 청크와 이어 붙임
+  std::vector<char> buf(kReadChunk);
+  std::size_t len = 0;
+  for (;;) {
+    if (len == buf.size()) buf.resize(buf.size() * 2); // 버퍼보다 긴 행
+    const std::size_t got = std::fread(buf.data() + len, 1, buf.size() - len, fp.get());
+    len += got;
+    const bool eof = got == 0;
+
+    std::size_t start = 0;
+    for (;;) {
+      const void* nl = std::memchr(buf.data() + start, '\n', len - start);
+      if (!nl) break;
+      const std::size_t end = (std::size_t)(static_cast<const char*>(nl) - buf.data());
+      onLine(std::string_view(buf.data() + start, end - start));
+      start = end + 1;
+    }
+    if (eof) {
+      if (start < len) onLine(std::string_view(buf.data() + start, len - start));
+      break;
+    }
+    std::memmove(buf.data(), buf.data() + start, len - start);
+    len -= start;
+  }
+  if (std::ferror(fp.get())) throw std::runtime_error("CsvMotionImporter: read error: " + path);
+  if (header) throw std::runtime_error("CsvMotionImporter: empty file: " + path);
+  if (unseen > 0 && stats.rows > 0) {
+    const std::size_t k = (std::size_t)(std::find(seen.begin(), seen.end(), 0) - seen.begin());
+    throw std::runtime_error("CsvMotionImporter: no valid value for motor id " + std::to_string(ids[k]) + ": " + path);
+  }
+
+  kf->finish();
+  return stats;
+}
+
+CsvImportStats CsvMotionImporter::importInto(const std::string& path, MotionEditor& me) const {
+  // 실패하면 원래 프레임이 남도록 복제본에 채운 뒤 교체
+  MotionEditor out(me);
+  out.clearFrames();
+  const CsvImportStats stats = run(path, [&](Frame&& f) { out.appendFrame(std::move(f)); });
+  me = std::move(out);
+  return stats;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
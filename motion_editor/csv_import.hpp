@@ -0,0 +1,70 @@
+/*
+ * CSV Import
+ * @file csv_import.hpp
+ * Single-pass, constant-memory import of recorded joint-state logs (CSV) into
+ * motion frames, with keyframe extraction while reading.
+ *
+ * Key features:
+ * - Header row -> column mapping through the editor's joint name -> motor id
+ *   mapping (unknown columns ignored or rejected)
+ * - Fixed-size read buffer, fields parsed in place with std::from_chars
+ * - Keyframes: every row, every N-th row, or a tolerance mode that keeps only
+ *   the samples needed so linear interpolation between keyframes stays within
+ *   tolerance of every recorded sample (per joint, O(joints) state)
+ * - Frames are handed to a sink as they are produced (nothing is buffered)
+ */
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+enum class KeyframeMode {
+  All,       // 모든 행
+  Decimate,  // stride 행마다 1개 (마지막 행 포함)
+  Tolerance  // 선형 보간 오차가 tolerance 를 넘기 직전 샘플만
+};
+
+struct CsvImportOptions {
+  char delimiter{','};
+  std::string time_column{"time"};
+  double time_scale{1.0};       // 시간 열 1 단위의 초 (ns 타임스탬프면 1e-9)
+  double position_scale{1.0};   // 위치 열 1 단위의 rad (deg 로그면 pi/180)
+  double tick_sec{0.001};       // Frame::time 1 단위의 초 (기본 ms)
+  KeyframeMode mode{KeyframeMode::Tolerance};
+  std::size_t stride{1};        // Decimate
+  double tolerance{1e-3};       // Tolerance [rad]
+  double max_interval_sec{0.0}; // Tolerance: 키프레임 최대 간격 (0 = 제한 없음)
+  bool strict_columns{false};   // 시간/관절이 아닌 열이 있으면 예외
+};
+
+struct CsvImportStats {
+  std::size_t rows{0};         // 읽은 데이터 행
+  std::size_t skipped_rows{0}; // 시간 열을 못 읽었거나 시간이 감소한 행, 또는 아직 값이 없는 관절이 있는 앞쪽 행
+  std::size_t frames{0};       // 내보낸 프레임
+  std::size_t joints{0};       // 매핑된 관절 열 수
+};
+
+class CsvMotionImporter {
+public:
+  // 프레임 하나가 완성될 때마다 호출 (이름 "0", "1", ..., delay/repeat 0)
+  using FrameSink = std::function<void(Frame&&)>;
+
+  // me: 관절명 -> 모터ID 매핑 제공 (jointId)
+  CsvMotionImporter(const MotionEditor& me, const CsvImportOptions& opt = CsvImportOptions{});
+
+  CsvImportStats run(const std::string& path, const FrameSink& sink) const;
+
+  // 편집기 프레임을 가져온 프레임으로 교체 (메타 항목은 유지)
+  CsvImportStats importInto(const std::string& path, MotionEditor& me) const;
+
+private:
+  const MotionEditor& me_;
+  CsvImportOptions opt_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,164 @@
+/*
+ * Embedded Export
+ * @file embedded_export.cpp
+ * constexpr header generation and EmbeddedMotion -> MotionEditor conversion.
+ */
+
+#include "motion_editor/embedded_export.hpp"
+
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
+#include "motion_editor/joint_columns.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+const char* const kNs = "ROBIT_HUMANOID_MOTION_EDITOR";
+
+bool isIdentifier(const std::string& s) {
+  if (s.empty() || std::isdigit((unsigned char)s[0])) return false;
+  for (char c : s) {
+    if (!std::isalnum((unsigned char)c) && c != '_') return false;
+  }
+  return true;
+}
+
+// "a::b" 형태의 네임스페이스 이름 검사
+bool isNamespace(const std::string& ns) {
+  std::size_t begin = 0;
+  for (;;) {
+    const std::size_t sep = ns.find("::", begin);
+    if (!isIdentifier(ns.substr(begin, sep - begin))) return false;
+    if (sep == std::string::npos) return true;
+    begin = sep + 2;
+  }
+}
+
+// C++ 문자열 리터럴 (출력 불가 문자/UTF-8 바이트는 3자리 8진 이스케이프)
+void appendLiteral(std::string& out, const std::string& s) {
+  out += '"';
+  for (unsigned char c : s) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += (char)c;
+    } else if (c >= 0x20 && c < 0x7f) {
+      out += (char)c;
+    } else {
+      char buf[8];
+      std::snprintf(buf, sizeof buf, "\\%03o", c);
+      out += buf;
+    }
+  }
+  out += '"';
+}
+
+void appendDouble(std::string& out, double v) {
+  if (!std::isfinite(v)) throw std::runtime_error("EmbeddedHeaderWriter: non-finite joint position");
+  char buf[32];
+  std::snprintf(buf, sizeof buf, "%.17g", v);
+  out += buf;
+}
+} // namespace
+
+void EmbeddedHeaderWriter::add(const std::string& symbol, const MotionEditor& me) {
+  if (!isIdentifier(symbol)) throw std::runtime_error("EmbeddedHeaderWriter: invalid symbol: " + symbol);
+  for (const auto& e : entries_) {
+    if (e.symbol == symbol) throw std::runtime_error("EmbeddedHeaderWriter: duplicate symbol: " + symbol);
+  }
+  entries_.push_back(Entry{symbol, me});
+}
+
+std::string EmbeddedHeaderWriter::str(const std::string& ns) const {
+  if (!ns.empty() && !isNamespace(ns)) throw std::runtime_error("EmbeddedHeaderWriter: invalid namespace: " + ns);
+
+  std::string out;
+  out += "// Generated by motion_editor (EmbeddedHeaderWriter). Do not edit.\n";
+  out += "#pragma once\n\n#include \"motion_editor/embedded_motion.hpp\"\n\n";
+  if (!ns.empty()) out += "namespace " + ns + "\n{\n";
+
+  for (const auto& e : entries_) {
+    const MotionEditor& me = e.motion;
+    const JointColumns cols = JointColumns::extractAll(me);
+    const std::size_t N = cols.frames(), J = cols.joints();
+    const std::string& s = e.symbol;
+
+    // 프레임 표
+    if (N) {
+      out += "inline constexpr " + std::string(kNs) + "::EmbeddedFrameInfo " + s + "Frames[] = {\n";
+      for (std::size_t i = 0; i < N; ++i) {
+        const Frame& f = me.frameAt(i);
+        out += "  {" + std::to_string(f.time) + ", " + std::to_string(f.delay) + ", " +
+               std::to_string(f.repeat) + ", " + (me.isSelected(i) ? "true" : "false") + ", ";
+        appendLiteral(out, f.name);
+        out += "},\n";
+      }
+      out += "};\n";
+    }
+
+    // 관절 ID / 위치 행렬 (프레임 한 행)
+    if (J) {
+      out += "inline constexpr int " + s + "Ids[] = {";
+      for (std::size_t k = 0; k < J; ++k) out += (k ? ", " : "") + std::to_string(cols.ids()[k]);
+      out += "};\n";
+    }
+    if (N && J) {
+      out += "inline constexpr double " + s + "Positions[] = {\n";
+      for (std::size_t i = 0; i < N; ++i) {
+        out += "  ";
+        for (std::size_t k = 0; k < J; ++k) {
+          appendDouble(out, cols.column(k)[i]);
+          out += ",";
+          if (k + 1 < J) out += ' ';
+        }
+        out += '\n';
+      }
+      out += "};\n";
+    }
+
+    out += "inline constexpr " + std::string(kNs) + "::EmbeddedMotionData " + s + "{\n  ";
+    appendLiteral(out, me.motionName());
+    out += ",\n  " + (N ? s + "Frames" : std::string("nullptr")) + ", " + std::to_string(N) + ",\n";
+    out += "  " + (J ? s + "Ids" : std::string("nullptr")) + ", " + std::to_string(J) + ",\n";
+    out += "  " + (N && J ? s + "Positions" : std::string("nullptr")) + "};\n\n";
+  }
+
+  if (!ns.empty()) out += "} // namespace " + ns + "\n";
+  return out;
+}
+
+void EmbeddedHeaderWriter::writeToFile(const std::string& path, const std::string& ns) const {
+  const std::string text = str(ns);
+  std::ofstream ofs(path, std::ios::binary);
+  if (!ofs) throw std::runtime_error("EmbeddedHeaderWriter: cannot open file to write: " + path);
+  ofs.write(text.data(), (std::streamsize)text.size());
+  if (!ofs) throw std::runtime_error("EmbeddedHeaderWriter: write failed: " + path);
+}
+
+void exportEmbeddedHeader(const MotionEditor& me, const std::string& path, const std::string& symbol,
+                          const std::string& ns) {
+  EmbeddedHeaderWriter w;
+  w.add(symbol, me);
+  w.writeToFile(path, ns);
+}
+
+void loadEmbedded(const EmbeddedMotion& em, MotionEditor& me) {
+  me.clearFrames();
+  if (!em.name().empty()) me.setMotionName(std::string(em.name()));
+  for (std::size_t i = 0; i < em.size(); ++i) {
+    const auto fv = em[i];
+    Frame f;
+    f.time = fv.time;
+    f.delay = fv.delay;
+    f.repeat = fv.repeat;
+    f.selected = fv.selected;
+    f.name = std::string(fv.name);
+    f.dxl.reserve(fv.dxl.size());
+    for (std::size_t k = 0; k < fv.dxl.size(); ++k) f.dxl.push_back(DxlValue{fv.dxl[k].id, fv.dxl[k].position});
+    me.appendFrame(std::move(f));
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
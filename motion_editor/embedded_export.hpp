@@ -0,0 +1,50 @@
+/*
+ * Embedded Export
+ * @file embedded_export.hpp
+ * Generates C++ headers of constexpr arrays from loaded motions, for firmware /
+ * safety-fallback motions that must exist before any filesystem is mounted.
+ *
+ * Key features:
+ * - Per motion: frame table (time, delay, repeat, selected, name), joint id list,
+ *   frames x joints position matrix and an EmbeddedMotionData aggregate
+ * - Several motions per header, optional namespace
+ * - Positions printed with 17 significant digits (exact double round trip)
+ * - Frames missing a joint hold the previous frame's value (JointColumns rule)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "motion_editor/embedded_motion.hpp"
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+class EmbeddedHeaderWriter {
+public:
+  // symbol: C++ 식별자 (예: kSafetyCrouch) -> kSafetyCrouchFrames / Ids / Positions 배열 + kSafetyCrouch
+  // 호출 시점의 프레임을 복사해 두므로 me 는 이후 바뀌어도 됨
+  void add(const std::string& symbol, const MotionEditor& me);
+
+  // ns 비우면 전역 네임스페이스
+  std::string str(const std::string& ns = {}) const;
+  void writeToFile(const std::string& path, const std::string& ns = {}) const;
+
+private:
+  struct Entry {
+    std::string symbol;
+    MotionEditor motion; // O(1) 복제본
+  };
+  std::vector<Entry> entries_;
+};
+
+// 모션 하나짜리 헤더 (EmbeddedHeaderWriter 편의 함수)
+void exportEmbeddedHeader(const MotionEditor& me, const std::string& path, const std::string& symbol,
+                          const std::string& ns = {});
+
+// 임베디드 모션 -> 편집기 (프레임 교체, 메타 name 설정)
+void loadEmbedded(const EmbeddedMotion& em, MotionEditor& me);
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,102 @@
+/*
+ * Embedded Motion
+ * @file embedded_motion.hpp
+ * Read-only view over motions compiled into the binary as constexpr arrays
+ * (headers generated by embedded_export.hpp), usable before any filesystem exists.
+ *
+ * Key features:
+ * - Plain aggregates only: no parsing, no allocation, no yaml-cpp dependency
+ * - Joint positions are one frames x joints row-major matrix
+ * - EmbeddedMotion satisfies the Source requirements of motion_sampler.hpp,
+ *   so TimelineSampler / findFrameIndex run unchanged over embedded data
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct EmbeddedFrameInfo {
+  int time;
+  int delay;
+  int repeat;
+  bool selected;
+  std::string_view name;
+};
+
+// 생성된 헤더가 정의하는 모션 하나 (모든 포인터는 정적 수명 배열)
+struct EmbeddedMotionData {
+  std::string_view name;            // 메타 name (없으면 빈 문자열)
+  const EmbeddedFrameInfo* frames;
+  std::size_t frame_count;
+  const int* ids;                   // 행렬 열 순서의 모터ID
+  std::size_t joint_count;
+  const double* positions;          // frame_count x joint_count (행 우선) [rad]
+};
+
+class EmbeddedMotion {
+public:
+  struct Dxl {
+    int id;
+    double position; // rad
+  };
+
+  // 프레임 한 행 (Frame::dxl 과 같은 방식으로 인덱싱)
+  struct DxlRow {
+    const int* ids;
+    const double* pos;
+    std::size_t n;
+
+    constexpr std::size_t size() const { return n; }
+    constexpr Dxl operator[](std::size_t k) const { return Dxl{ids[k], pos[k]}; }
+  };
+
+  struct FrameView {
+    int time;
+    int delay;
+    int repeat;
+    bool selected;
+    std::string_view name;
+    DxlRow dxl;
+  };
+
+  constexpr explicit EmbeddedMotion(const EmbeddedMotionData& data) : d_(&data) {}
+
+  constexpr std::string_view name() const { return d_->name; }
+  constexpr std::size_t size() const { return d_->frame_count; }
+  constexpr std::size_t joints() const { return d_->joint_count; }
+  constexpr int jointId(std::size_t k) const { return d_->ids[k]; }
+
+  constexpr FrameView operator[](std::size_t i) const {
+    const EmbeddedFrameInfo& f = d_->frames[i];
+    return FrameView{f.time, f.delay, f.repeat, f.selected, f.name,
+                     DxlRow{d_->ids, d_->positions + i * d_->joint_count, d_->joint_count}};
+  }
+
+  // 모터ID -> 열 (없으면 -1)
+  constexpr int column(int motor_id) const {
+    for (std::size_t k = 0; k < d_->joint_count; ++k) {
+      if (d_->ids[k] == motor_id) return (int)k;
+    }
+    return -1;
+  }
+
+  // 이름으로 첫 프레임 인덱스 (없으면 -1)
+  constexpr long find(std::string_view step_name) const {
+    for (std::size_t i = 0; i < d_->frame_count; ++i) {
+      if (d_->frames[i].name == step_name) return (long)i;
+    }
+    return -1;
+  }
+
+  constexpr double position(std::size_t frame, std::size_t column) const {
+    return d_->positions[frame * d_->joint_count + column];
+  }
+
+private:
+  const EmbeddedMotionData* d_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
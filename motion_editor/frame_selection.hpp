@@ -0,0 +1,135 @@
+/*
+ * Frame Selection
+ * @file frame_selection.hpp
+ * Bitset over frame indices for GUI-style selections of many frames.
+ *
+ * Key features:
+ * - One bit per frame (64 frames per word), set operations word by word
+ * - Range select, invert, popcount and set-bit iteration without visiting
+ *   unselected frames
+ * - MotionEditor keeps one per motion and writes it to Frame::selected on save
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+class FrameSelection {
+public:
+  FrameSelection() = default;
+  explicit FrameSelection(std::size_t n, bool on = false) { resize(n, on); }
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  // 늘어난 프레임은 on 으로 채움
+  void resize(std::size_t n, bool on = false) {
+    const std::size_t old = size_;
+    words_.resize((n + 63) / 64, 0);
+    size_ = n;
+    if (on && n > old) setRange(old, n, true);
+    trim();
+  }
+  void push_back(bool on) {
+    if ((size_ & 63) == 0) words_.push_back(0);
+    if (on) words_[size_ >> 6] |= bit(size_);
+    ++size_;
+  }
+
+  bool test(std::size_t i) const { return (words_[i >> 6] & bit(i)) != 0; }
+  void set(std::size_t i, bool on = true) {
+    if (on) words_[i >> 6] |= bit(i);
+    else words_[i >> 6] &= ~bit(i);
+  }
+
+  // [first, last) 구간 (범위를 벗어나면 예외)
+  void setRange(std::size_t first, std::size_t last, bool on = true) {
+    if (first > last || last > size_) throw std::out_of_range("FrameSelection: range out of bounds");
+    while (first < last) {
+      const std::size_t w = first >> 6;
+      const std::size_t end = std::min(last, (w + 1) * 64);
+      const std::size_t len = end - first;
+      const std::uint64_t mask = (len == 64 ? ~std::uint64_t(0) : ((std::uint64_t(1) << len) - 1)) << (first & 63);
+      if (on) words_[w] |= mask;
+      else words_[w] &= ~mask;
+      first = end;
+    }
+  }
+  void setAll(bool on = true) {
+    for (auto& w : words_) w = on ? ~std::uint64_t(0) : 0;
+    trim();
+  }
+  void invert() {
+    for (auto& w : words_) w = ~w;
+    trim();
+  }
+
+  std::size_t count() const {
+    std::size_t n = 0;
+    for (auto w : words_) n += (std::size_t)__builtin_popcountll(w);
+    return n;
+  }
+  bool any() const {
+    for (auto w : words_) if (w) return true;
+    return false;
+  }
+
+  // 선택된 인덱스를 오름차순으로 방문 (빈 워드는 건너뜀)
+  template <class Fn>
+  void forEach(Fn&& fn) const {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+      for (std::uint64_t bits = words_[w]; bits; bits &= bits - 1) {
+        fn(w * 64 + (std::size_t)__builtin_ctzll(bits));
+      }
+    }
+  }
+  std::vector<std::size_t> indices() const {
+    std::vector<std::size_t> out;
+    out.reserve(count());
+    forEach([&](std::size_t i) { out.push_back(i); });
+    return out;
+  }
+
+  // 집합 연산 (크기가 다르면 예외)
+  FrameSelection& operator|=(const FrameSelection& o) { return combine(o, [](auto a, auto b) { return a | b; }); }
+  FrameSelection& operator&=(const FrameSelection& o) { return combine(o, [](auto a, auto b) { return a & b; }); }
+  FrameSelection& operator^=(const FrameSelection& o) { return combine(o, [](auto a, auto b) { return a ^ b; }); }
+  FrameSelection& operator-=(const FrameSelection& o) { return combine(o, [](auto a, auto b) { return a & ~b; }); }
+
+  friend FrameSelection operator|(FrameSelection a, const FrameSelection& b) { return a |= b; }
+  friend FrameSelection operator&(FrameSelection a, const FrameSelection& b) { return a &= b; }
+  friend FrameSelection operator^(FrameSelection a, const FrameSelection& b) { return a ^= b; }
+  friend FrameSelection operator-(FrameSelection a, const FrameSelection& b) { return a -= b; }
+  friend FrameSelection operator~(FrameSelection a) {
+    a.invert();
+    return a;
+  }
+
+  bool operator==(const FrameSelection& o) const { return size_ == o.size_ && words_ == o.words_; }
+  bool operator!=(const FrameSelection& o) const { return !(*this == o); }
+
+private:
+  static std::uint64_t bit(std::size_t i) { return std::uint64_t(1) << (i & 63); }
+
+  // 마지막 워드의 size_ 이후 비트는 항상 0 (count/== 가 그대로 성립하도록)
+  void trim() {
+    if (size_ & 63) words_.back() &= (std::uint64_t(1) << (size_ & 63)) - 1;
+  }
+
+  template <class Op>
+  FrameSelection& combine(const FrameSelection& o, Op op) {
+    if (o.size_ != size_) throw std::runtime_error("FrameSelection: size mismatch");
+    for (std::size_t w = 0; w < words_.size(); ++w) words_[w] = op(words_[w], o.words_[w]);
+    return *this;
+  }
+
+  std::vector<std::uint64_t> words_;
+  std::size_t size_{0};
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,177 @@
+/*
+ * Inverse Kinematics
+ * @file inverse_kinematics.cpp
+ * Position-only damped-least-squares IK and warm-started range edits.
+ *
+ * Jacobian column of revolute link k (base frame):
+ *   J_k = a_k x (p_ee - o_k),  a_k = R_k * axis_k,  o_k = link origin
+ * Step: dq = J^T y,  (J J^T + lambda^2 I) y = e,  e = target - p_ee
+ */
+
+#include "motion_editor/inverse_kinematics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+// 프레임 dxl 에서 관절값 찾기 (없으면 false)
+bool findPosition(const Frame& f, int id, double& out) {
+  for (const auto& dv : f.dxl) {
+    if (dv.id == id) { out = dv.position; return true; }
+  }
+  return false;
+}
+} // namespace
+
+InverseKinematics::InverseKinematics(const KinematicChain& chain, const std::string& effector,
+                                     const std::vector<int>& solve_ids, const IkOptions& opt)
+: chain_(chain), effector_(chain.endEffectorIndex(effector)), opt_(opt) {
+  if (effector_ < 0) throw std::runtime_error("InverseKinematics: unknown end effector: " + effector);
+
+  // 끝점 링크에서 base 까지 부모를 따라가며 움직이는 링크 수집
+  const auto& links = chain_.links();
+  for (int k = chain_.endEffectors()[effector_].link; k >= 0; k = links[k].parent) {
+    const int id = links[k].id;
+    if (id < 0) continue;
+    if (!solve_ids.empty() && std::find(solve_ids.begin(), solve_ids.end(), id) == solve_ids.end()) continue;
+    links_.push_back(k);
+    ids_.push_back(id);
+  }
+  for (int id : solve_ids) {
+    if (std::find(ids_.begin(), ids_.end(), id) == ids_.end()) {
+      throw std::runtime_error("InverseKinematics: motor id " + std::to_string(id) +
+                               " is not on the chain of " + effector);
+    }
+  }
+  if (links_.empty()) throw std::runtime_error("InverseKinematics: no joints to solve for " + effector);
+}
+
+int InverseKinematics::solve(const Vec3& target, std::vector<double>& q, double& err) const {
+  std::vector<Pose> poses;
+  return solve(target, q, err, poses);
+}
+
+int InverseKinematics::solve(const Vec3& target, std::vector<double>& q, double& err,
+                             std::vector<Pose>& poses) const {
+  const auto& links = chain_.links();
+  if (q.size() != links.size()) throw std::runtime_error("InverseKinematics: q size must equal link count");
+
+  const std::size_t n = links_.size();
+  const double lambda2 = opt_.damping * opt_.damping;
+  // 열 우선 3 x n 야코비안 (스레드별 스크래치, 호출마다 재할당 없음)
+  thread_local std::vector<double> J;
+  J.resize(3 * n);
+
+  int it = 0;
+  for (;; ++it) {
+    chain_.forward(q.data(), poses);
+    const Vec3 p = chain_.effectorPosition(poses, effector_);
+    const double ex = target.x - p.x, ey = target.y - p.y, ez = target.z - p.z;
+    err = std::sqrt(ex * ex + ey * ey + ez * ez);
+    if (err <= opt_.tolerance || it >= opt_.max_iterations) break;
+
+    // J 와 A = J J^T + lambda^2 I (대칭 3x3)
+    double a00 = lambda2, a01 = 0, a02 = 0, a11 = lambda2, a12 = 0, a22 = lambda2;
+    for (std::size_t m = 0; m < n; ++m) {
+      const KinematicLink& l = links[links_[m]];
+      const Pose& P = poses[links_[m]];
+      const double ax = P.R[0] * l.axis.x + P.R[1] * l.axis.y + P.R[2] * l.axis.z;
+      const double ay = P.R[3] * l.axis.x + P.R[4] * l.axis.y + P.R[5] * l.axis.z;
+      const double az = P.R[6] * l.axis.x + P.R[7] * l.axis.y + P.R[8] * l.axis.z;
+      const double rx = p.x - P.p.x, ry = p.y - P.p.y, rz = p.z - P.p.z;
+      double* c = &J[3 * m];
+      c[0] = ay * rz - az * ry;
+      c[1] = az * rx - ax * rz;
+      c[2] = ax * ry - ay * rx;
+      a00 += c[0] * c[0]; a01 += c[0] * c[1]; a02 += c[0] * c[2];
+      a11 += c[1] * c[1]; a12 += c[1] * c[2]; a22 += c[2] * c[2];
+    }
+
+    // y = A^-1 e (여인수 전개, lambda > 0 이면 A 는 양의 정부호)
+    const double c00 = a11 * a22 - a12 * a12;
+    const double c01 = a02 * a12 - a01 * a22;
+    const double c02 = a01 * a12 - a02 * a11;
+    const double det = a00 * c00 + a01 * c01 + a02 * c02;
+    if (std::abs(det) < 1e-300) break;
+    const double c11 = a00 * a22 - a02 * a02;
+    const double c12 = a01 * a02 - a00 * a12;
+    const double c22 = a00 * a11 - a01 * a01;
+    const double inv = 1.0 / det;
+    const double yx = (c00 * ex + c01 * ey + c02 * ez) * inv;
+    const double yy = (c01 * ex + c11 * ey + c12 * ez) * inv;
+    const double yz = (c02 * ex + c12 * ey + c22 * ez) * inv;
+
+    // dq = J^T y, 가장 큰 변화가 max_step 을 넘으면 전체를 같은 비율로 축소
+    double max_dq = 0.0;
+    for (std::size_t m = 0; m < n; ++m) {
+      const double* c = &J[3 * m];
+      max_dq = std::max(max_dq, std::abs(c[0] * yx + c[1] * yy + c[2] * yz));
+    }
+    const double s = (opt_.max_step > 0.0 && max_dq > opt_.max_step) ? opt_.max_step / max_dq : 1.0;
+    for (std::size_t m = 0; m < n; ++m) {
+      const double* c = &J[3 * m];
+      q[links_[m]] += s * (c[0] * yx + c[1] * yy + c[2] * yz);
+    }
+  }
+  return it;
+}
+
+IkReport InverseKinematics::moveTo(MotionEditor& me, const Vec3& target,
+                                   std::size_t begin, std::size_t end) const {
+  return solveRange(me, begin, end, [&](std::size_t) { return target; });
+}
+
+IkReport InverseKinematics::moveTo(MotionEditor& me, const std::vector<Vec3>& targets,
+                                   std::size_t begin) const {
+  return solveRange(me, begin, begin + targets.size(),
+                    [&](std::size_t i) { return targets[i - begin]; });
+}
+
+template <class TargetAt>
+IkReport InverseKinematics::solveRange(MotionEditor& me, std::size_t begin, std::size_t end,
+                                       TargetAt target_at) const {
+  if (begin > end || end > me.frameCount()) {
+    throw std::runtime_error("InverseKinematics: frame range out of bounds");
+  }
+
+  const auto& links = chain_.links();
+  std::vector<double> q(links.size(), 0.0);
+  std::vector<double> warm(links_.size(), 0.0);
+  std::vector<Pose> poses;
+  std::vector<DxlValue> values;
+  values.reserve(links_.size());
+
+  IkReport rep;
+  for (std::size_t i = begin; i < end; ++i) {
+    const Frame& f = me.frameAt(i);
+    // 풀지 않는 관절은 이 프레임 값 그대로 (없으면 0 rad)
+    for (std::size_t k = 0; k < links.size(); ++k) {
+      q[k] = 0.0;
+      if (links[k].id >= 0) findPosition(f, links[k].id, q[k]);
+    }
+    // 푸는 관절은 직전 프레임 해에서 출발 (첫 프레임은 자기 값)
+    if (i > begin) {
+      for (std::size_t m = 0; m < links_.size(); ++m) q[links_[m]] = warm[m];
+    }
+
+    double err = 0.0;
+    rep.iterations += (std::size_t)solve(target_at(i), q, err, poses);
+    ++rep.frames;
+    if (err <= opt_.tolerance) ++rep.converged;
+    rep.max_error = std::max(rep.max_error, err);
+
+    values.clear();
+    for (std::size_t m = 0; m < links_.size(); ++m) {
+      warm[m] = q[links_[m]];
+      double cur = 0.0;
+      // 값이 그대로인 관절은 건드리지 않음 (공유 프레임 복사 방지)
+      if (!findPosition(f, ids_[m], cur) || cur != warm[m]) values.push_back(DxlValue{ids_[m], warm[m]});
+    }
+    if (!values.empty()) me.editJointIdsAt(i, values);
+  }
+  return rep;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,71 @@
+/*
+ * Inverse Kinematics
+ * @file inverse_kinematics.hpp
+ * Cartesian end-effector edits over frame ranges ("move right_hand to (x,y,z)
+ * on frames 10..40") solved per frame with damped least squares.
+ *
+ * Key features:
+ * - Position-only DLS: dq = J^T (J J^T + lambda^2 I)^-1 e  (3x3 solve per iteration)
+ * - Solves the moving links between the end effector and base (optionally a subset)
+ * - Each frame is warm-started from the previous frame's solution, so a range
+ *   converges in a few iterations per frame
+ * - Results go through MotionEditor::editJointIdsAt (zone maps / copy-on-write kept)
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "motion_editor/kinematics.hpp"
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct IkOptions {
+  double damping{0.02};     // lambda [m] (특이 자세 근처에서 스텝 크기 제한)
+  double tolerance{1e-4};   // 위치 오차 허용치 [m]
+  int max_iterations{30};   // 프레임당 최대 반복
+  double max_step{0.25};    // 반복당 관절 변화 상한 [rad]
+};
+
+// 범위 편집 결과 요약
+struct IkReport {
+  std::size_t frames{0};     // 푼 프레임 수
+  std::size_t converged{0};  // tolerance 안에 들어온 프레임 수
+  std::size_t iterations{0}; // 전체 반복 수 (frames 로 나누면 프레임당 평균)
+  double max_error{0.0};     // 가장 큰 남은 위치 오차 [m]
+};
+
+class InverseKinematics {
+public:
+  // solve_ids 비우면 끝점 ~ base 경로의 움직이는 링크 전체를 풂
+  // (예: 팔만 풀고 허리는 고정하려면 팔 관절 ID 만 지정)
+  InverseKinematics(const KinematicChain& chain, const std::string& effector,
+                    const std::vector<int>& solve_ids = {}, const IkOptions& opt = IkOptions{});
+
+  // 푸는 관절의 모터ID (끝점 쪽부터)
+  const std::vector<int>& jointIds() const { return ids_; }
+
+  // 단일 자세: q 는 링크 인덱스 순서 관절각 (크기 = 링크 수), 푸는 관절만 갱신
+  // 반환: 반복 수, err = 남은 위치 오차 [m]
+  int solve(const Vec3& target, std::vector<double>& q, double& err) const;
+
+  // [begin, end) 프레임에서 끝점을 target 으로 이동
+  IkReport moveTo(MotionEditor& me, const Vec3& target, std::size_t begin, std::size_t end) const;
+  // 프레임별 목표 (targets[k] -> begin + k 프레임)
+  IkReport moveTo(MotionEditor& me, const std::vector<Vec3>& targets, std::size_t begin) const;
+
+private:
+  int solve(const Vec3& target, std::vector<double>& q, double& err, std::vector<Pose>& poses) const;
+  template <class TargetAt>
+  IkReport solveRange(MotionEditor& me, std::size_t begin, std::size_t end, TargetAt target_at) const;
+
+  const KinematicChain& chain_;
+  int effector_{-1};
+  std::vector<int> links_; // 푸는 링크 인덱스 (끝점 쪽부터)
+  std::vector<int> ids_;   // links_[k] 의 모터ID
+  IkOptions opt_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,90 @@
+/*
+ * Joint Columns
+ * @file joint_columns.cpp
+ * Frame-major MotionEditor storage <-> per-joint contiguous columns.
+ */
+
+#include "motion_editor/joint_columns.hpp"
+
+#include <algorithm>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+JointColumns JointColumns::extract(const MotionEditor& me, const std::vector<int>& ids) {
+  for (std::size_t a = 0; a < ids.size(); ++a) {
+    for (std::size_t b = a + 1; b < ids.size(); ++b) {
+      if (ids[a] == ids[b]) throw std::runtime_error("JointColumns: duplicate motor id " + std::to_string(ids[a]));
+    }
+  }
+
+  JointColumns c;
+  c.ids_ = ids;
+  c.frames_ = me.frameCount();
+  const std::size_t J = ids.size(), N = c.frames_;
+  c.data_.assign(J * N, 0.0);
+  c.present_.assign(J * N, 0);
+
+  std::vector<int> slots(J, -1);
+  std::vector<double> last(J, 0.0);
+  for (std::size_t i = 0; i < N; ++i) {
+    const Frame& f = me.frameAt(i);
+    const int n = (int)f.dxl.size();
+    for (std::size_t k = 0; k < J; ++k) {
+      // 레이아웃이 같은 연속 프레임은 캐시된 slot 으로 비교 1회
+      int s = slots[k];
+      if (s < 0 || s >= n || f.dxl[s].id != ids[k]) {
+        s = -1;
+        for (int t = 0; t < n; ++t) {
+          if (f.dxl[t].id == ids[k]) { s = t; break; }
+        }
+        if (s >= 0) slots[k] = s;
+      }
+      if (s >= 0) {
+        last[k] = f.dxl[s].position;
+        c.present_[k * N + i] = 1;
+      }
+      c.data_[k * N + i] = last[k];
+    }
+  }
+  return c;
+}
+
+JointColumns JointColumns::extractAll(const MotionEditor& me) {
+  std::vector<int> ids;
+  for (std::size_t i = 0; i < me.frameCount(); ++i) {
+    for (const auto& dv : me.frameAt(i).dxl) {
+      if (std::find(ids.begin(), ids.end(), dv.id) == ids.end()) ids.push_back(dv.id);
+    }
+  }
+  return extract(me, ids);
+}
+
+int JointColumns::columnOf(int id) const {
+  auto it = std::find(ids_.begin(), ids_.end(), id);
+  return it == ids_.end() ? -1 : (int)(it - ids_.begin());
+}
+
+void JointColumns::writeBack(MotionEditor& me, std::size_t begin, std::size_t end) const {
+  if (me.frameCount() != frames_) throw std::runtime_error("JointColumns: frame count changed since extract");
+  if (begin > end || end > frames_) throw std::runtime_error("JointColumns: frame range out of bounds");
+
+  std::vector<DxlValue> values;
+  values.reserve(ids_.size());
+  for (std::size_t i = begin; i < end; ++i) {
+    const Frame& f = me.frameAt(i);
+    values.clear();
+    for (std::size_t k = 0; k < ids_.size(); ++k) {
+      if (!present_[k * frames_ + i]) continue;
+      const double v = data_[k * frames_ + i];
+      // 값이 그대로인 프레임은 건드리지 않음 (공유 프레임 복사 방지)
+      for (const auto& dv : f.dxl) {
+        if (dv.id != ids_[k]) continue;
+        if (dv.position != v) values.push_back(DxlValue{ids_[k], v});
+        break;
+      }
+    }
+    if (!values.empty()) me.editJointIdsAt(i, values);
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,55 @@
+/*
+ * Joint Columns
+ * @file joint_columns.hpp
+ * Structure-of-arrays copy of selected joint positions across all frames,
+ * for numeric passes (kinematics, filtering) that want contiguous per-joint data.
+ *
+ * Key features:
+ * - One contiguous column of frameCount() doubles per requested motor id
+ * - Single pass over the frames with a cached dxl slot per joint
+ * - Frames missing a joint hold the previous frame's value (0 before the first)
+ * - writeBack() pushes edited columns into the editor through editJointIds semantics
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+class JointColumns {
+public:
+  JointColumns() = default;
+
+  // ids 순서대로 열 생성 (ID 중복 불가)
+  static JointColumns extract(const MotionEditor& me, const std::vector<int>& ids);
+  // 모션에 등장하는 모든 ID (첫 프레임 순서 + 이후 등장 순)
+  static JointColumns extractAll(const MotionEditor& me);
+
+  std::size_t frames() const { return frames_; }
+  std::size_t joints() const { return ids_.size(); }
+  const std::vector<int>& ids() const { return ids_; }
+
+  // 열 k 의 연속 배열 (길이 frames())
+  const double* column(std::size_t k) const { return data_.data() + k * frames_; }
+  double* column(std::size_t k) { return data_.data() + k * frames_; }
+  // 모터ID 로 열 찾기 (-1 = 없음)
+  int columnOf(int id) const;
+
+  // 원래 그 관절이 있던 프레임인지 (채워 넣은 값이면 false)
+  bool present(std::size_t k, std::size_t frame) const { return present_[k * frames_ + frame] != 0; }
+
+  // 열 값을 [begin, end) 프레임에 다시 기록 (없던 관절은 추가하지 않음)
+  void writeBack(MotionEditor& me, std::size_t begin, std::size_t end) const;
+  void writeBack(MotionEditor& me) const { writeBack(me, 0, frames_); }
+
+private:
+  std::vector<int> ids_;
+  std::size_t frames_{0};
+  std::vector<double> data_;           // joints x frames (열 우선)
+  std::vector<unsigned char> present_; // joints x frames
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,194 @@
+/*
+ * Joint Groups
+ * @file joint_groups.cpp
+ * Named joint groups loaded from a config file and group-level edits.
+ */
+
+#include "motion_editor/joint_groups.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+JointGroupSet JointGroupSet::loadFromFile(const std::string& path, const MotionEditor& me) {
+  YAML::Node root = YAML::LoadFile(path);
+  if (!root["groups"] || !root["groups"].IsMap()) {
+    throw std::runtime_error("JointGroupSet: missing 'groups' mapping: " + path);
+  }
+
+  JointGroupSet set;
+  for (const auto& kv : root["groups"]) {
+    set.addGroup(kv.first.as<std::string>(), kv.second.as<std::vector<std::string>>(), me);
+  }
+  return set;
+}
+
+void JointGroupSet::addGroup(const std::string& name, const std::vector<std::string>& joints,
+                             const MotionEditor& me) {
+  if (find(name)) throw std::runtime_error("JointGroupSet: duplicate group: " + name);
+
+  CompiledJointGroup g;
+  g.name = name;
+  g.joints = joints;
+  g.ids.reserve(joints.size());
+  for (const auto& j : joints) {
+    const int id = me.jointId(j);
+    if (id < 0) throw std::runtime_error("JointGroupSet: unknown joint '" + j + "' in group " + name);
+    if (id > kMaxMotorId) throw std::runtime_error("JointGroupSet: motor id out of range: " + j);
+    if (g.id_mask.test(id)) throw std::runtime_error("JointGroupSet: joint listed twice: " + j);
+    g.ids.push_back(id);
+    g.id_mask.set(id);
+  }
+  groups_.push_back(std::move(g));
+}
+
+const CompiledJointGroup* JointGroupSet::find(std::string_view name) const {
+  for (const auto& g : groups_) {
+    if (g.name == name) return &g;
+  }
+  return nullptr;
+}
+
+const CompiledJointGroup& JointGroupSet::at(std::string_view name) const {
+  const CompiledJointGroup* g = find(name);
+  if (!g) throw std::runtime_error("JointGroupSet: unknown group: " + std::string(name));
+  return *g;
+}
+
+// ===== JointGroupEditor =====
+
+JointGroupEditor::JointGroupEditor(MotionEditor& me, const CompiledJointGroup& group)
+: me_(me), group_(group) {}
+
+void JointGroupEditor::resolveSlots(const Frame& f, std::vector<int>& slots) const {
+  const int n = (int)f.dxl.size();
+  for (std::size_t k = 0; k < group_.ids.size(); ++k) {
+    int s = slots[k];
+    if (s >= 0 && s < n && f.dxl[s].id == group_.ids[k]) continue;
+    s = -1;
+    for (int i = 0; i < n; ++i) {
+      if (f.dxl[i].id == group_.ids[k]) { s = i; break; }
+    }
+    slots[k] = s;
+  }
+}
+
+void JointGroupEditor::checkRange(std::size_t begin, std::size_t end) const {
+  if (begin > end || end > me_.frameCount()) {
+    throw std::runtime_error("JointGroupEditor: frame range out of bounds (" + group_.name + ")");
+  }
+}
+
+void JointGroupEditor::checkValues(const std::vector<double>& v) const {
+  if (v.size() != group_.size()) {
+    throw std::runtime_error("JointGroupEditor: expected " + std::to_string(group_.size()) +
+                             " values for group " + group_.name);
+  }
+}
+
+void JointGroupEditor::set(std::size_t frame, const std::vector<double>& values) {
+  set(frame, frame + 1, values);
+}
+
+void JointGroupEditor::set(std::size_t begin, std::size_t end, const std::vector<double>& values) {
+  checkRange(begin, end);
+  checkValues(values);
+
+  std::vector<int> slots(group_.size(), -1);
+  for (std::size_t i = begin; i < end; ++i) {
+    Frame& f = me_.mutableFrameAt(i);
+    resolveSlots(f, slots);
+    for (std::size_t k = 0; k < slots.size(); ++k) {
+      if (slots[k] >= 0) {
+        f.dxl[slots[k]].position = values[k];
+      } else {
+        f.dxl.push_back(DxlValue{group_.ids[k], values[k]});
+        slots[k] = (int)f.dxl.size() - 1;
+      }
+    }
+  }
+}
+
+void JointGroupEditor::offset(std::size_t begin, std::size_t end, const std::vector<double>& deltas) {
+  checkRange(begin, end);
+  checkValues(deltas);
+
+  std::vector<int> slots(group_.size(), -1);
+  for (std::size_t i = begin; i < end; ++i) {
+    Frame& f = me_.mutableFrameAt(i);
+    resolveSlots(f, slots);
+    for (std::size_t k = 0; k < slots.size(); ++k) {
+      if (slots[k] >= 0) f.dxl[slots[k]].position += deltas[k];
+    }
+  }
+}
+
+void JointGroupEditor::offset(std::size_t begin, std::size_t end, double delta) {
+  offset(begin, end, std::vector<double>(group_.size(), delta));
+}
+
+void JointGroupEditor::scale(std::size_t begin, std::size_t end, const std::vector<double>& factors) {
+  checkRange(begin, end);
+  checkValues(factors);
+
+  std::vector<int> slots(group_.size(), -1);
+  for (std::size_t i = begin; i < end; ++i) {
+    Frame& f = me_.mutableFrameAt(i);
+    resolveSlots(f, slots);
+    for (std::size_t k = 0; k < slots.size(); ++k) {
+      if (slots[k] >= 0) f.dxl[slots[k]].position *= factors[k];
+    }
+  }
+}
+
+void JointGroupEditor::scale(std::size_t begin, std::size_t end, double factor) {
+  scale(begin, end, std::vector<double>(group_.size(), factor));
+}
+
+void JointGroupEditor::copy(std::size_t src, std::size_t begin, std::size_t end) {
+  if (src >= me_.frameCount()) throw std::runtime_error("JointGroupEditor: source frame out of range");
+  // src 가 대상 범위 안에 있어도 안전하도록 값부터 확보
+  const std::vector<double> values = read(src);
+
+  checkRange(begin, end);
+  std::vector<int> slots(group_.size(), -1);
+  for (std::size_t i = begin; i < end; ++i) {
+    if (i == src) continue;
+    Frame& f = me_.mutableFrameAt(i);
+    resolveSlots(f, slots);
+    for (std::size_t k = 0; k < slots.size(); ++k) {
+      if (std::isnan(values[k])) continue; // 원본에 없는 관절
+      if (slots[k] >= 0) {
+        f.dxl[slots[k]].position = values[k];
+      } else {
+        f.dxl.push_back(DxlValue{group_.ids[k], values[k]});
+        slots[k] = (int)f.dxl.size() - 1;
+      }
+    }
+  }
+}
+
+std::vector<double> JointGroupEditor::read(std::size_t frame) const {
+  std::vector<double> out;
+  read(frame, frame + 1, out);
+  return out;
+}
+
+void JointGroupEditor::read(std::size_t begin, std::size_t end, std::vector<double>& out) const {
+  checkRange(begin, end);
+  const std::size_t K = group_.size();
+  out.assign((end - begin) * K, std::numeric_limits<double>::quiet_NaN());
+
+  std::vector<int> slots(K, -1);
+  for (std::size_t i = begin; i < end; ++i) {
+    const Frame& f = me_.frameAt(i);
+    resolveSlots(f, slots);
+    double* row = out.data() + (i - begin) * K;
+    for (std::size_t k = 0; k < K; ++k) {
+      if (slots[k] >= 0) row[k] = f.dxl[slots[k]].position;
+    }
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,101 @@
+/*
+ * Joint Groups
+ * @file joint_groups.hpp
+ * Named joint groups (left_arm, right_leg, torso, ...) loaded from a config file
+ * and group-level edits over single frames or frame ranges.
+ *
+ * Key features:
+ * - YAML config -> groups precompiled into a motor-id bitset + motor-id list
+ * - Frame slots resolved per dxl layout by JointGroupEditor and cached across
+ *   consecutive frames with the same layout
+ * - set / offset / scale / copy / read over [begin, end) frame ranges
+ * - Each range operation is a single pass over the frames
+ */
+
+#pragma once
+
+#include <bitset>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+// 관절명 -> 모터ID 로 컴파일된 그룹
+struct CompiledJointGroup {
+  std::string name;
+  std::vector<std::string> joints;          // 설정 파일 순서
+  std::vector<int> ids;                     // joints[k] 의 모터ID
+  std::bitset<kMaxMotorId + 1> id_mask;     // 그룹 소속 여부 O(1) 판정
+
+  std::size_t size() const { return ids.size(); }
+  bool containsId(int id) const { return id >= 0 && id <= kMaxMotorId && id_mask.test(id); }
+};
+
+class JointGroupSet {
+public:
+  JointGroupSet() = default;
+
+  // YAML 로드 (관절명은 me 의 매핑으로 해석, 모르는 이름은 예외)
+  //   groups:
+  //     left_arm: [rotate_0, rotate_2]
+  //     torso: [rotate_torso]
+  static JointGroupSet loadFromFile(const std::string& path, const MotionEditor& me);
+
+  void addGroup(const std::string& name, const std::vector<std::string>& joints,
+                const MotionEditor& me);
+
+  // 없으면 nullptr
+  const CompiledJointGroup* find(std::string_view name) const;
+  // 없으면 예외
+  const CompiledJointGroup& at(std::string_view name) const;
+
+  const std::vector<CompiledJointGroup>& groups() const { return groups_; }
+
+private:
+  std::vector<CompiledJointGroup> groups_;
+};
+
+// 그룹 단위 편집기: 값 벡터는 항상 그룹 관절 순서 (CompiledJointGroup::ids)
+// 프레임 범위는 [begin, end) 인덱스
+class JointGroupEditor {
+public:
+  JointGroupEditor(MotionEditor& me, const CompiledJointGroup& group);
+
+  // 절대값 지정 (프레임에 없는 관절은 추가)
+  void set(std::size_t frame, const std::vector<double>& values);
+  void set(std::size_t begin, std::size_t end, const std::vector<double>& values);
+
+  // 관절별 / 공통 오프셋 (프레임에 없는 관절은 건너뜀)
+  void offset(std::size_t begin, std::size_t end, const std::vector<double>& deltas);
+  void offset(std::size_t begin, std::size_t end, double delta);
+
+  // 관절별 / 공통 배율 (0 rad 기준)
+  void scale(std::size_t begin, std::size_t end, const std::vector<double>& factors);
+  void scale(std::size_t begin, std::size_t end, double factor);
+
+  // src 프레임의 그룹 관절 값을 [begin, end) 에 복사
+  void copy(std::size_t src, std::size_t begin, std::size_t end);
+
+  // 읽기: 없는 관절은 NaN
+  std::vector<double> read(std::size_t frame) const;
+  // [begin, end) 를 프레임 우선(frames x group size) 으로 out 에 기록
+  void read(std::size_t begin, std::size_t end, std::vector<double>& out) const;
+
+  // 그룹 전체(모든 프레임)에 대한 편의 함수
+  void offsetAll(double delta) { offset(0, me_.frameCount(), delta); }
+  void scaleAll(double factor) { scale(0, me_.frameCount(), factor); }
+
+private:
+  // slot 캐시 검증/갱신: 레이아웃이 같은 연속 프레임은 관절당 비교 1회
+  void resolveSlots(const Frame& f, std::vector<int>& slots) const;
+  void checkRange(std::size_t begin, std::size_t end) const;
+  void checkValues(const std::vector<double>& v) const;
+
+  MotionEditor& me_;
+  const CompiledJointGroup& group_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,313 @@
+/*
+ * Kinematics
+ * @file kinematics.cpp
+ * Chain loading, single-pose FK and the blocked SoA batch FK kernel.
+ *
+ * Rotation about unit axis a by q (Rodrigues):
+ *   R = I + sin(q) K + (1 - cos(q)) (a a^T - I),  K = [a]x
+ * so per link only sin/cos vary per frame; the rest are 3x3 constants.
+ */
+
+#include "motion_editor/kinematics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+constexpr std::size_t kBlock = 64; // 블록당 프레임 수 (스크래치가 L1/L2 에 들어가는 크기)
+constexpr std::size_t kSlot = 12;  // 링크당 성분 수: R 9 + p 3
+
+Vec3 parseVec3(const YAML::Node& n, const Vec3& def, const std::string& what) {
+  if (!n) return def;
+  if (!n.IsSequence() || n.size() != 3) throw std::runtime_error("KinematicChain: " + what + " must be [x, y, z]");
+  return Vec3{n[0].as<double>(), n[1].as<double>(), n[2].as<double>()};
+}
+
+// 축 a 에 대한 로드리게스 상수: K = [a]x, M = a a^T - I
+void rodrigues(const Vec3& a, double K[9], double M[9]) {
+  const double k[9] = {0, -a.z, a.y, a.z, 0, -a.x, -a.y, a.x, 0};
+  const double v[3] = {a.x, a.y, a.z};
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      K[3 * i + j] = k[3 * i + j];
+      M[3 * i + j] = v[i] * v[j] - (i == j ? 1.0 : 0.0);
+    }
+  }
+}
+} // namespace
+
+// ===== KinematicChain =====
+
+KinematicChain KinematicChain::loadFromFile(const std::string& path, const MotionEditor& me) {
+  YAML::Node root = YAML::LoadFile(path);
+  if (!root["links"] || !root["links"].IsSequence()) {
+    throw std::runtime_error("KinematicChain: missing 'links' sequence: " + path);
+  }
+
+  KinematicChain chain;
+  for (const auto& l : root["links"]) {
+    if (!l["name"]) throw std::runtime_error("KinematicChain: link without name: " + path);
+    const std::string name = l["name"].as<std::string>();
+
+    int id = -1;
+    if (l["joint"]) {
+      const std::string joint = l["joint"].as<std::string>();
+      id = me.jointId(joint);
+      if (id < 0) throw std::runtime_error("KinematicChain: unknown joint '" + joint + "' in link " + name);
+    } else if (l["id"]) {
+      id = l["id"].as<int>();
+    }
+
+    chain.addLink(name, id, l["parent"] ? l["parent"].as<std::string>() : std::string(),
+                  parseVec3(l["axis"], Vec3{0.0, 0.0, 1.0}, "axis of " + name),
+                  parseVec3(l["offset"], Vec3{}, "offset of " + name));
+  }
+
+  if (root["end_effectors"]) {
+    for (const auto& e : root["end_effectors"]) {
+      if (!e["name"] || !e["link"]) throw std::runtime_error("KinematicChain: end effector needs name and link");
+      const std::string name = e["name"].as<std::string>();
+      chain.addEndEffector(name, e["link"].as<std::string>(), parseVec3(e["tip"], Vec3{}, "tip of " + name));
+    }
+  }
+  return chain;
+}
+
+int KinematicChain::addLink(const std::string& name, int id, const std::string& parent, Vec3 axis, Vec3 offset) {
+  if (linkIndex(name) >= 0) throw std::runtime_error("KinematicChain: duplicate link: " + name);
+
+  int parent_idx = -1;
+  if (!parent.empty() && parent != "base") {
+    parent_idx = linkIndex(parent);
+    if (parent_idx < 0) throw std::runtime_error("KinematicChain: parent '" + parent + "' must be listed before " + name);
+  }
+
+  const double len = std::sqrt(axis.x * axis.x + axis.y * axis.y + axis.z * axis.z);
+  if (len < 1e-12) throw std::runtime_error("KinematicChain: zero rotation axis: " + name);
+  axis = Vec3{axis.x / len, axis.y / len, axis.z / len};
+
+  links_.push_back(KinematicLink{name, id, parent_idx, axis, offset});
+  return (int)links_.size() - 1;
+}
+
+int KinematicChain::addEndEffector(const std::string& name, const std::string& link, Vec3 tip) {
+  if (endEffectorIndex(name) >= 0) throw std::runtime_error("KinematicChain: duplicate end effector: " + name);
+  const int li = linkIndex(link);
+  if (li < 0) throw std::runtime_error("KinematicChain: unknown link '" + link + "' for end effector " + name);
+  effectors_.push_back(EndEffector{name, li, tip});
+  return (int)effectors_.size() - 1;
+}
+
+int KinematicChain::linkIndex(const std::string& name) const {
+  for (std::size_t i = 0; i < links_.size(); ++i) {
+    if (links_[i].name == name) return (int)i;
+  }
+  return -1;
+}
+
+int KinematicChain::endEffectorIndex(const std::string& name) const {
+  for (std::size_t i = 0; i < effectors_.size(); ++i) {
+    if (effectors_[i].name == name) return (int)i;
+  }
+  return -1;
+}
+
+std::vector<int> KinematicChain::jointIds() const {
+  std::vector<int> ids;
+  for (const auto& l : links_) {
+    if (l.id >= 0) ids.push_back(l.id);
+  }
+  return ids;
+}
+
+void KinematicChain::forward(const double* q, std::vector<Pose>& poses) const {
+  poses.resize(links_.size());
+  const Pose base;
+  for (std::size_t k = 0; k < links_.size(); ++k) {
+    const KinematicLink& l = links_[k];
+    const Pose& par = l.parent < 0 ? base : poses[l.parent];
+    Pose& out = poses[k];
+
+    const double* Rp = par.R;
+    out.p.x = par.p.x + Rp[0] * l.offset.x + Rp[1] * l.offset.y + Rp[2] * l.offset.z;
+    out.p.y = par.p.y + Rp[3] * l.offset.x + Rp[4] * l.offset.y + Rp[5] * l.offset.z;
+    out.p.z = par.p.z + Rp[6] * l.offset.x + Rp[7] * l.offset.y + Rp[8] * l.offset.z;
+
+    if (l.id < 0) {
+      std::copy(Rp, Rp + 9, out.R);
+      continue;
+    }
+    double K[9], M[9], Rl[9];
+    rodrigues(l.axis, K, M);
+    const double s = std::sin(q[k]), c1 = 1.0 - std::cos(q[k]);
+    for (int ij = 0; ij < 9; ++ij) Rl[ij] = (ij % 4 == 0 ? 1.0 : 0.0) + s * K[ij] + c1 * M[ij];
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        out.R[3 * i + j] = Rp[3 * i] * Rl[j] + Rp[3 * i + 1] * Rl[3 + j] + Rp[3 * i + 2] * Rl[6 + j];
+      }
+    }
+  }
+}
+
+Vec3 KinematicChain::effectorPosition(const std::vector<Pose>& poses, int effector) const {
+  const EndEffector& e = effectors_.at(effector);
+  const Pose& P = poses.at(e.link);
+  return Vec3{P.p.x + P.R[0] * e.tip.x + P.R[1] * e.tip.y + P.R[2] * e.tip.z,
+              P.p.y + P.R[3] * e.tip.x + P.R[4] * e.tip.y + P.R[5] * e.tip.z,
+              P.p.z + P.R[6] * e.tip.x + P.R[7] * e.tip.y + P.R[8] * e.tip.z};
+}
+
+// ===== ForwardKinematics =====
+
+ForwardKinematics::ForwardKinematics(const KinematicChain& chain, unsigned threads)
+: chain_(chain),
+  threads_(threads ? threads : std::max(1u, std::thread::hardware_concurrency())) {}
+
+std::vector<EffectorTrajectory> ForwardKinematics::run(const MotionEditor& me,
+                                                       const std::vector<std::string>& effectors) const {
+  return run(JointColumns::extract(me, chain_.jointIds()), effectors);
+}
+
+std::vector<EffectorTrajectory> ForwardKinematics::run(const JointColumns& cols,
+                                                       const std::vector<std::string>& effectors) const {
+  // 대상 끝점
+  std::vector<int> ee;
+  if (effectors.empty()) {
+    for (std::size_t e = 0; e < chain_.endEffectors().size(); ++e) ee.push_back((int)e);
+  } else {
+    for (const auto& name : effectors) {
+      const int e = chain_.endEffectorIndex(name);
+      if (e < 0) throw std::runtime_error("ForwardKinematics: unknown end effector: " + name);
+      ee.push_back(e);
+    }
+  }
+
+  const std::size_t N = cols.frames();
+  std::vector<EffectorTrajectory> out(ee.size());
+  for (std::size_t k = 0; k < ee.size(); ++k) {
+    out[k].name = chain_.endEffectors()[ee[k]].name;
+    out[k].x.resize(N);
+    out[k].y.resize(N);
+    out[k].z.resize(N);
+  }
+
+  // 링크별 관절각 열 (nullptr = 고정 링크 또는 열 없음 -> 회전 없음)
+  std::vector<const double*> q(chain_.links().size(), nullptr);
+  for (std::size_t k = 0; k < q.size(); ++k) {
+    const int id = chain_.links()[k].id;
+    const int c = id >= 0 ? cols.columnOf(id) : -1;
+    if (c >= 0) q[k] = cols.column(c);
+  }
+
+  const std::size_t blocks = (N + kBlock - 1) / kBlock;
+  const std::size_t scratch_size = (chain_.links().size() + 1) * kSlot * kBlock + 11 * kBlock;
+
+  auto work = [&](std::size_t b0, std::size_t b1) {
+    std::vector<double> scratch(scratch_size, 0.0);
+    // base 슬롯: R = I, p = 0
+    double* base = scratch.data() + chain_.links().size() * kSlot * kBlock;
+    for (int d = 0; d < 9; d += 4) std::fill(base + d * kBlock, base + (d + 1) * kBlock, 1.0);
+    for (std::size_t b = b0; b < b1; ++b) {
+      const std::size_t begin = b * kBlock;
+      runBlock(q, ee, begin, std::min(kBlock, N - begin), scratch, out);
+    }
+  };
+
+  // 블록이 적으면 스레드 생성 비용이 더 큼
+  const std::size_t T = std::min<std::size_t>(threads_, std::max<std::size_t>(1, blocks / 16));
+  if (T <= 1) {
+    work(0, blocks);
+  } else {
+    std::vector<std::thread> pool;
+    pool.reserve(T);
+    for (std::size_t t = 0; t < T; ++t) pool.emplace_back(work, blocks * t / T, blocks * (t + 1) / T);
+    for (auto& th : pool) th.join();
+  }
+  return out;
+}
+
+void ForwardKinematics::runBlock(const std::vector<const double*>& q, const std::vector<int>& effectors,
+                                 std::size_t begin, std::size_t n, std::vector<double>& scratch,
+                                 std::vector<EffectorTrajectory>& out) const {
+  const auto& links = chain_.links();
+  const std::size_t L = links.size(), B = kBlock;
+  double* const S = scratch.data();
+  const double* const base = S + L * kSlot * B;
+  double* const sn = S + (L + 1) * kSlot * B; // sin(q)
+  double* const c1 = sn + B;                  // 1 - cos(q)
+  double* const rl = c1 + B;                  // 로컬 회전 9성분
+
+  for (std::size_t k = 0; k < L; ++k) {
+    const KinematicLink& lk = links[k];
+    const double* Rp = lk.parent < 0 ? base : S + lk.parent * kSlot * B;
+    const double* pp = Rp + 9 * B;
+    double* R = S + k * kSlot * B;
+    double* p = R + 9 * B;
+
+    // p = p_parent + R_parent * offset
+    for (std::size_t m = 0; m < 3; ++m) {
+      const double* r0 = Rp + (3 * m) * B;
+      const double* r1 = r0 + B;
+      const double* r2 = r1 + B;
+      const double* pin = pp + m * B;
+      double* po = p + m * B;
+      for (std::size_t l = 0; l < n; ++l) {
+        po[l] = pin[l] + r0[l] * lk.offset.x + r1[l] * lk.offset.y + r2[l] * lk.offset.z;
+      }
+    }
+
+    if (!q[k]) {
+      std::copy(Rp, Rp + 9 * B, R);
+      continue;
+    }
+
+    const double* qk = q[k] + begin;
+    for (std::size_t l = 0; l < n; ++l) {
+      sn[l] = std::sin(qk[l]);
+      c1[l] = 1.0 - std::cos(qk[l]);
+    }
+
+    double K[9], M[9];
+    rodrigues(lk.axis, K, M);
+    for (std::size_t ij = 0; ij < 9; ++ij) {
+      const double id = (ij % 4 == 0) ? 1.0 : 0.0, kk = K[ij], mm = M[ij];
+      double* o = rl + ij * B;
+      for (std::size_t l = 0; l < n; ++l) o[l] = id + sn[l] * kk + c1[l] * mm;
+    }
+
+    // R = R_parent * R_local
+    for (std::size_t i = 0; i < 3; ++i) {
+      const double* a0 = Rp + (3 * i) * B;
+      const double* a1 = a0 + B;
+      const double* a2 = a1 + B;
+      for (std::size_t j = 0; j < 3; ++j) {
+        const double* b0 = rl + j * B;
+        const double* b1 = rl + (3 + j) * B;
+        const double* b2 = rl + (6 + j) * B;
+        double* o = R + (3 * i + j) * B;
+        for (std::size_t l = 0; l < n; ++l) o[l] = a0[l] * b0[l] + a1[l] * b1[l] + a2[l] * b2[l];
+      }
+    }
+  }
+
+  // 끝점 = p_link + R_link * tip
+  for (std::size_t e = 0; e < effectors.size(); ++e) {
+    const EndEffector& ef = chain_.endEffectors()[effectors[e]];
+    const double* R = S + ef.link * kSlot * B;
+    const double* p = R + 9 * B;
+    double* dst[3] = {out[e].x.data() + begin, out[e].y.data() + begin, out[e].z.data() + begin};
+    for (std::size_t m = 0; m < 3; ++m) {
+      const double* r0 = R + (3 * m) * B;
+      const double* r1 = r0 + B;
+      const double* r2 = r1 + B;
+      const double* pm = p + m * B;
+      double* o = dst[m];
+      for (std::size_t l = 0; l < n; ++l) o[l] = pm[l] + r0[l] * ef.tip.x + r1[l] * ef.tip.y + r2[l] * ef.tip.z;
+    }
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
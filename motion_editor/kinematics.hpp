@@ -0,0 +1,113 @@
+/*
+ * Kinematics
+ * @file kinematics.hpp
+ * Serial-chain (tree) robot description and batched forward kinematics over
+ * every frame of a motion.
+ *
+ * Key features:
+ * - YAML chain description: parent, rotation axis, offset per joint
+ * - Link transform = parent * Trans(offset) * Rot(axis, q)
+ * - Batch FK works on 64-frame blocks in structure-of-arrays form
+ *   (one array per rotation/position component) so the inner loops vectorize
+ * - Frame blocks are split across threads
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "motion_editor/joint_columns.hpp"
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct Vec3 {
+  double x{0.0};
+  double y{0.0};
+  double z{0.0};
+};
+
+// 링크 좌표계 (R: 행 우선 3x3, p: 관절 원점 위치) - base 기준
+struct Pose {
+  double R[9]{1, 0, 0, 0, 1, 0, 0, 0, 1};
+  Vec3 p;
+};
+
+struct KinematicLink {
+  std::string name;
+  int id{-1};       // 모터ID (-1 = 고정 링크)
+  int parent{-1};   // 링크 인덱스 (-1 = base)
+  Vec3 axis{0.0, 0.0, 1.0}; // 회전축 (단위벡터로 정규화되어 저장)
+  Vec3 offset;      // 부모 좌표계에서 이 관절 원점까지
+};
+
+struct EndEffector {
+  std::string name;
+  int link{-1};
+  Vec3 tip; // 링크 좌표계에서의 끝점
+};
+
+class KinematicChain {
+public:
+  KinematicChain() = default;
+
+  // YAML 로드 (관절명은 me 의 매핑으로 해석)
+  //   links:              # 부모가 먼저 나오도록 나열, parent 생략/base = 루트
+  //     - {name: torso, joint: rotate_torso, parent: base, axis: [0,0,1], offset: [0,0,0.2]}
+  //     - {name: r_elbow, id: 4, parent: r_shoulder, axis: [0,1,0], offset: [0,0,-0.1]}
+  //   end_effectors:
+  //     - {name: right_hand, link: r_elbow, tip: [0,0,-0.12]}
+  static KinematicChain loadFromFile(const std::string& path, const MotionEditor& me);
+
+  // 반환: 링크/끝점 인덱스
+  int addLink(const std::string& name, int id, const std::string& parent, Vec3 axis, Vec3 offset);
+  int addEndEffector(const std::string& name, const std::string& link, Vec3 tip);
+
+  const std::vector<KinematicLink>& links() const { return links_; }
+  const std::vector<EndEffector>& endEffectors() const { return effectors_; }
+  int linkIndex(const std::string& name) const;       // 없으면 -1
+  int endEffectorIndex(const std::string& name) const; // 없으면 -1
+
+  // 움직이는 링크들의 모터ID (링크 순서)
+  std::vector<int> jointIds() const;
+
+  // 단일 자세 FK: q[k] = 링크 k 의 관절각 (고정 링크 값은 무시), poses 크기 = 링크 수
+  void forward(const double* q, std::vector<Pose>& poses) const;
+  Vec3 effectorPosition(const std::vector<Pose>& poses, int effector) const;
+
+private:
+  std::vector<KinematicLink> links_;
+  std::vector<EndEffector> effectors_;
+};
+
+// 끝점 궤적 (프레임별 base 좌표, 성분별 연속 배열)
+struct EffectorTrajectory {
+  std::string name;
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+};
+
+class ForwardKinematics {
+public:
+  // threads = 0 이면 하드웨어 스레드 수
+  explicit ForwardKinematics(const KinematicChain& chain, unsigned threads = 0);
+
+  // 모든 프레임의 끝점 궤적 (effectors 비우면 전체)
+  std::vector<EffectorTrajectory> run(const MotionEditor& me,
+                                      const std::vector<std::string>& effectors = {}) const;
+  // 이미 추출한 열 사용 (열에 없는 관절은 0 rad)
+  std::vector<EffectorTrajectory> run(const JointColumns& cols,
+                                      const std::vector<std::string>& effectors = {}) const;
+
+private:
+  void runBlock(const std::vector<const double*>& q, const std::vector<int>& effectors,
+                std::size_t begin, std::size_t n, std::vector<double>& scratch,
+                std::vector<EffectorTrajectory>& out) const;
+
+  const KinematicChain& chain_;
+  unsigned threads_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,284 @@
+/*
+ * Motion Client
+ * @file motion_client.cpp
+ */
+
+#include "motion_editor/motion_client.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+std::string bodyOf(const std::function<void(proto::Writer&)>& fn) {
+  std::string body;
+  proto::Writer w(body);
+  fn(w);
+  return body;
+}
+} // namespace
+
+MotionClient::MotionClient(const std::string& socket_path) {
+  sockaddr_un addr{};
+  if (socket_path.size() >= sizeof(addr.sun_path)) {
+    throw std::runtime_error("MotionClient: socket path too long: " + socket_path);
+  }
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+  fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd_ < 0) throw std::runtime_error("MotionClient: socket failed: " + std::string(std::strerror(errno)));
+  if (::connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+    const std::string err = std::strerror(errno);
+    ::close(fd_);
+    throw std::runtime_error("MotionClient: cannot connect to " + socket_path + ": " + err);
+  }
+}
+
+MotionClient::~MotionClient() {
+  ::close(fd_);
+}
+
+// ===== 요청 =====
+
+std::vector<std::string> MotionClient::list() {
+  const std::string body = call(proto::Op::List, {});
+  proto::Reader in(body.data(), body.size());
+  std::vector<std::string> names(in.u32());
+  for (auto& n : names) n = std::string(in.str());
+  return names;
+}
+
+RemoteMotionInfo MotionClient::info(const std::string& motion) {
+  const std::string body = call(proto::Op::Info, bodyOf([&](proto::Writer& w) { w.str(motion); }));
+  proto::Reader in(body.data(), body.size());
+  RemoteMotionInfo r;
+  r.generation = in.u64();
+  r.frames = in.u32();
+  r.motion_name = std::string(in.str());
+  r.type = std::string(in.str());
+  r.motor_ids.resize(in.u32());
+  for (auto& id : r.motor_ids) id = in.i32();
+  return r;
+}
+
+std::vector<std::string> MotionClient::stepNames(const std::string& motion) {
+  const std::string body = call(proto::Op::StepNames, bodyOf([&](proto::Writer& w) { w.str(motion); }));
+  proto::Reader in(body.data(), body.size());
+  std::vector<std::string> names(in.u32());
+  for (auto& n : names) n = std::string(in.str());
+  return names;
+}
+
+Frame MotionClient::getFrame(const std::string& motion, const std::string& step) {
+  const std::string body = call(proto::Op::GetFrame, bodyOf([&](proto::Writer& w) {
+    w.str(motion);
+    w.str(step);
+  }));
+  proto::Reader in(body.data(), body.size());
+  return in.frame();
+}
+
+std::vector<Frame> MotionClient::getFrames(const std::string& motion, std::size_t first, std::size_t count) {
+  const std::string body = call(proto::Op::GetFrames, bodyOf([&](proto::Writer& w) {
+    w.str(motion);
+    w.u32((std::uint32_t)std::min<std::size_t>(first, UINT32_MAX));
+    w.u32((std::uint32_t)std::min<std::size_t>(count, UINT32_MAX));
+  }));
+  proto::Reader in(body.data(), body.size());
+  const std::uint32_t n = in.u32();
+  std::vector<Frame> frames;
+  frames.reserve(n);
+  for (std::uint32_t k = 0; k < n; ++k) frames.push_back(in.frame());
+  return frames;
+}
+
+void MotionClient::editJoints(const std::string& motion, const std::string& step,
+                              const std::vector<DxlValue>& values) {
+  const std::string body = bodyOf([&](proto::Writer& w) {
+    w.str(motion);
+    w.str(step);
+    w.u32((std::uint32_t)values.size());
+    for (const auto& dv : values) {
+      w.i32(dv.id);
+      w.f64(dv.position);
+    }
+  });
+  if (batching_) {
+    pending_.push_back(request(proto::Op::EditJoints, body));
+  } else {
+    call(proto::Op::EditJoints, body);
+  }
+}
+
+void MotionClient::setTiming(const std::string& motion, const std::string& step, int time, int delay) {
+  const std::string body = bodyOf([&](proto::Writer& w) {
+    w.str(motion);
+    w.str(step);
+    w.i32(time);
+    w.i32(delay);
+  });
+  if (batching_) {
+    pending_.push_back(request(proto::Op::SetTiming, body));
+  } else {
+    call(proto::Op::SetTiming, body);
+  }
+}
+
+void MotionClient::save(const std::string& motion) {
+  const std::string body = bodyOf([&](proto::Writer& w) { w.str(motion); });
+  if (batching_) {
+    pending_.push_back(request(proto::Op::Save, body));
+  } else {
+    call(proto::Op::Save, body);
+  }
+}
+
+std::size_t MotionClient::reload(const std::string& motion) {
+  const std::string body = call(proto::Op::Reload, bodyOf([&](proto::Writer& w) { w.str(motion); }));
+  proto::Reader in(body.data(), body.size());
+  return in.u32();
+}
+
+void MotionClient::beginBatch() {
+  batching_ = true;
+}
+
+void MotionClient::flush() {
+  batching_ = false;
+  sendAll();
+  std::string first_error;
+  for (std::uint32_t seq : pending_) {
+    const Response r = await(seq);
+    if (r.status != 0 && first_error.empty()) {
+      proto::Reader in(r.body.data(), r.body.size());
+      first_error = std::string(in.str());
+    }
+  }
+  pending_.clear();
+  if (!first_error.empty()) throw std::runtime_error(first_error);
+}
+
+void MotionClient::subscribe(bool on) {
+  call(proto::Op::Subscribe, bodyOf([&](proto::Writer& w) { w.u8(on ? 1 : 0); }));
+}
+
+std::optional<ChangeNotice> MotionClient::waitNotice(std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  for (;;) {
+    std::uint32_t seq;
+    Response resp;
+    if (popResponse(seq, resp)) throw std::runtime_error("MotionClient: unexpected response");
+    if (!notices_.empty()) {
+      ChangeNotice n = std::move(notices_.front());
+      notices_.pop_front();
+      return n;
+    }
+    const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+    if (left.count() <= 0 || !fill((int)left.count())) return std::nullopt;
+  }
+}
+
+// ===== 전송 =====
+
+std::uint32_t MotionClient::request(proto::Op op, const std::string& body) {
+  const std::uint32_t seq = next_seq_++;
+  proto::Message m(out_, seq, op);
+  out_ += body;
+  return seq;
+}
+
+std::string MotionClient::call(proto::Op op, const std::string& body) {
+  if (batching_) throw std::runtime_error("MotionClient: only edits and saves can be queued in a batch");
+  const std::uint32_t seq = request(op, body);
+  sendAll();
+  Response r = await(seq);
+  if (r.status != 0) {
+    proto::Reader in(r.body.data(), r.body.size());
+    throw std::runtime_error(std::string(in.str()));
+  }
+  return std::move(r.body);
+}
+
+void MotionClient::sendAll() {
+  std::size_t off = 0;
+  while (off < out_.size()) {
+    const ssize_t n = ::send(fd_, out_.data() + off, out_.size() - off, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      throw std::runtime_error("MotionClient: send failed: " + std::string(std::strerror(errno)));
+    }
+    off += (std::size_t)n;
+  }
+  out_.clear();
+}
+
+MotionClient::Response MotionClient::await(std::uint32_t seq) {
+  for (;;) {
+    std::uint32_t got;
+    Response r;
+    if (popResponse(got, r)) {
+      // 데몬은 연결별로 요청 순서대로 응답함
+      if (got != seq) throw std::runtime_error("MotionClient: out-of-order response");
+      return r;
+    }
+    fill(-1);
+  }
+}
+
+bool MotionClient::popResponse(std::uint32_t& seq, Response& resp) {
+  while (in_.size() >= proto::kHeaderSize) {
+    const proto::Header h = proto::getHeader(in_.data());
+    if (h.length > proto::kMaxBody) throw std::runtime_error("MotionClient: message too large");
+    if (in_.size() - proto::kHeaderSize < h.length) return false;
+    std::string body = in_.substr(proto::kHeaderSize, h.length);
+    in_.erase(0, proto::kHeaderSize + h.length);
+
+    if (h.op == proto::Op::Notify) {
+      proto::Reader in(body.data(), body.size());
+      ChangeNotice n;
+      n.motion = std::string(in.str());
+      n.kind = (proto::NoticeKind)in.u8();
+      n.generation = in.u64();
+      n.error = std::string(in.str());
+      notices_.push_back(std::move(n));
+      continue;
+    }
+    seq = h.seq;
+    resp = Response{h.status, std::move(body)};
+    return true;
+  }
+  return false;
+}
+
+bool MotionClient::fill(int timeout_ms) {
+  pollfd pfd{fd_, POLLIN, 0};
+  int r;
+  do {
+    r = ::poll(&pfd, 1, timeout_ms);
+  } while (r < 0 && errno == EINTR);
+  if (r < 0) throw std::runtime_error("MotionClient: poll failed: " + std::string(std::strerror(errno)));
+  if (r == 0) return false;
+
+  char buf[64 * 1024];
+  ssize_t n;
+  do {
+    n = ::read(fd_, buf, sizeof(buf));
+  } while (n < 0 && errno == EINTR);
+  if (n < 0) throw std::runtime_error("MotionClient: read failed: " + std::string(std::strerror(errno)));
+  if (n == 0) throw std::runtime_error("MotionClient: daemon closed the connection");
+  in_.append(buf, (std::size_t)n);
+  return true;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,97 @@
+/*
+ * Motion Client
+ * @file motion_client.hpp
+ * Blocking client for MotionDaemon (motion_protocol.hpp).
+ *
+ * Key features:
+ * - One call = one request/response round trip
+ * - beginBatch()/flush(): edits and saves are queued and sent in one write,
+ *   so the daemon handles (and publishes) them as one batch
+ * - Change notices that arrive while waiting for a response are queued and
+ *   returned by waitNotice()
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "motion_editor/motion_protocol.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct RemoteMotionInfo {
+  std::uint64_t generation{0};
+  std::size_t frames{0};
+  std::string motion_name;
+  std::string type;
+  std::vector<int> motor_ids;
+};
+
+struct ChangeNotice {
+  std::string motion;
+  proto::NoticeKind kind{};
+  std::uint64_t generation{0};
+  std::string error; // ReloadFailed / EditDropped 일 때만
+};
+
+class MotionClient {
+public:
+  explicit MotionClient(const std::string& socket_path);
+  ~MotionClient();
+
+  MotionClient(const MotionClient&) = delete;
+  MotionClient& operator=(const MotionClient&) = delete;
+
+  std::vector<std::string> list();
+  RemoteMotionInfo info(const std::string& motion);
+  std::vector<std::string> stepNames(const std::string& motion);
+  Frame getFrame(const std::string& motion, const std::string& step);
+  std::vector<Frame> getFrames(const std::string& motion, std::size_t first, std::size_t count);
+
+  // 배치 중이면 큐에만 넣고 바로 반환 (오류는 flush 에서)
+  void editJoints(const std::string& motion, const std::string& step, const std::vector<DxlValue>& values);
+  void setTiming(const std::string& motion, const std::string& step, int time, int delay);
+  void save(const std::string& motion);
+  std::size_t reload(const std::string& motion);
+
+  // 배치: begin 이후의 editJoints/setTiming/save 를 모아 flush 에서 한 번에 전송하고
+  // 모든 응답을 기다림 (첫 오류를 예외로)
+  void beginBatch();
+  void flush();
+
+  void subscribe(bool on = true);
+  // 통지 대기 (timeout 안에 없으면 nullopt)
+  std::optional<ChangeNotice> waitNotice(std::chrono::milliseconds timeout);
+
+private:
+  struct Response {
+    std::uint8_t status;
+    std::string body;
+  };
+
+  // 요청 하나 작성 (out_ 에 추가), 반환: seq
+  std::uint32_t request(proto::Op op, const std::string& body);
+  // 요청 즉시 전송 후 응답 본문 (오류 응답이면 예외)
+  std::string call(proto::Op op, const std::string& body);
+  void sendAll();
+  Response await(std::uint32_t seq);
+  // in_ 에서 완성된 메시지 하나를 꺼냄 (통지는 큐로 옮기고 계속), false = 응답 없음
+  bool popResponse(std::uint32_t& seq, Response& resp);
+  // 소켓에서 더 읽음, timeout_ms < 0 = 무한 대기, false = 시간 초과
+  bool fill(int timeout_ms);
+
+  int fd_{-1};
+  std::uint32_t next_seq_{1};
+  std::string out_;
+  std::string in_;
+  bool batching_{false};
+  std::vector<std::uint32_t> pending_; // 배치에서 응답을 기다리는 seq
+  std::deque<ChangeNotice> notices_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
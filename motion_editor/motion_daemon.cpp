@@ -0,0 +1,464 @@
+/*
+ * Motion Daemon
+ * @file motion_daemon.cpp
+ * poll loop, request batching and change notices.
+ *
+ * Loop iteration:
+ *   1) accept new connections, read every readable socket until EAGAIN and cut
+ *      the buffered bytes into complete requests (one batch across all clients)
+ *   2) handle the batch in arrival order; reads see the batch's own edits
+ *   3) publish each edited motion once, queue notices, then write the buffered
+ *      responses and notices (POLLOUT for whatever the socket did not take)
+ */
+
+#include "motion_editor/motion_daemon.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+constexpr std::size_t kReadChunk = 64 * 1024;
+
+void wake(int fd) {
+  const std::uint64_t one = 1;
+  (void)!::write(fd, &one, sizeof(one));
+}
+} // namespace
+
+struct MotionDaemon::Client {
+  int fd{-1};
+  std::string in;          // 아직 완성되지 않은 요청 바이트
+  std::string out;         // 미전송 응답/통지
+  std::size_t out_off{0};
+  bool subscribed{false};
+  bool dead{false};
+};
+
+struct MotionDaemon::Request {
+  Client* client;
+  std::uint32_t seq;
+  proto::Op op;
+  std::string body;
+};
+
+// 배치 하나 동안의 읽기 뷰 / 편집 사본
+struct MotionDaemon::Batch {
+  using EditOp = std::function<void(MotionEditor&)>;
+  struct Pending {
+    std::shared_ptr<const MotionEditor> base; // 사본을 만든 라이브러리 모션
+    std::shared_ptr<MotionEditor> motion;
+    std::vector<EditOp> ops;                  // 발행 전에 기준이 바뀌면 새 기준에 다시 적용
+  };
+
+  std::unordered_map<std::string, std::shared_ptr<const MotionEditor>> view;
+  std::unordered_map<std::string, Pending> dirty;
+  std::vector<std::string> dirty_order; // 발행/통지 순서 = 첫 편집 순서
+  std::vector<Notice> notices;
+
+  const MotionEditor& read(MotionLibrary& lib, const std::string& name) {
+    auto d = dirty.find(name);
+    if (d != dirty.end()) return *d->second.motion;
+    auto& v = view[name];
+    if (!v) v = lib.get(name);
+    if (!v) {
+      view.erase(name);
+      throw std::runtime_error("MotionDaemon: unknown motion: " + name);
+    }
+    return *v;
+  }
+
+  // 편집 사본에 op 적용 (op 가 예외면 기록하지 않음)
+  void edit(MotionLibrary& lib, const std::string& name, EditOp op) {
+    auto d = dirty.find(name);
+    if (d != dirty.end()) {
+      op(*d->second.motion);
+      d->second.ops.push_back(std::move(op));
+      return;
+    }
+    read(lib, name);
+    Pending p;
+    p.base = view[name];
+    p.motion = std::make_shared<MotionEditor>(*p.base); // O(1) 복제, 건드린 청크만 분리
+    op(*p.motion);
+    p.ops.push_back(std::move(op));
+    dirty_order.push_back(name);
+    dirty.emplace(name, std::move(p));
+  }
+};
+
+MotionDaemon::MotionDaemon(MotionLibrary& lib, const DaemonOptions& opt)
+: lib_(lib), opt_(opt) {
+  if (opt_.socket_path.empty()) throw std::runtime_error("MotionDaemon: empty socket path");
+  if (opt_.socket_path.size() >= sizeof(sockaddr_un::sun_path)) {
+    throw std::runtime_error("MotionDaemon: socket path too long: " + opt_.socket_path);
+  }
+}
+
+MotionDaemon::~MotionDaemon() {
+  stop();
+}
+
+void MotionDaemon::start() {
+  if (running()) return;
+
+  listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (listen_fd_ < 0) throw std::runtime_error("MotionDaemon: socket failed: " + std::string(std::strerror(errno)));
+
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, opt_.socket_path.c_str(), opt_.socket_path.size() + 1);
+  ::unlink(opt_.socket_path.c_str()); // 이전 실행이 남긴 소켓 파일
+  if (::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      ::listen(listen_fd_, 64) != 0) {
+    const std::string err = std::strerror(errno);
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+    throw std::runtime_error("MotionDaemon: cannot listen on " + opt_.socket_path + ": " + err);
+  }
+
+  wake_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wake_fd_ < 0) {
+    ::close(listen_fd_);
+    listen_fd_ = -1;
+    throw std::runtime_error("MotionDaemon: eventfd failed");
+  }
+
+  if (opt_.notify_reloads) {
+    lib_.setReloadCallback([this](const std::string& name, bool ok, std::size_t, const std::string& error) {
+      {
+        std::lock_guard<std::mutex> lk(notice_mu_);
+        reload_notices_.push_back(Notice{name, ok ? proto::NoticeKind::Reloaded : proto::NoticeKind::ReloadFailed,
+                                         lib_.generation(), error});
+      }
+      wake(wake_fd_);
+    });
+  }
+
+  stop_ = false;
+  thread_ = std::thread(&MotionDaemon::loop, this);
+}
+
+void MotionDaemon::stop() {
+  if (!running()) return;
+  if (opt_.notify_reloads) lib_.setReloadCallback(nullptr);
+  stop_ = true;
+  wake(wake_fd_);
+  thread_.join();
+
+  for (auto& c : clients_) ::close(c->fd);
+  clients_.clear();
+  ::close(listen_fd_);
+  ::close(wake_fd_);
+  listen_fd_ = wake_fd_ = -1;
+  ::unlink(opt_.socket_path.c_str());
+
+  std::lock_guard<std::mutex> lk(stats_mu_);
+  stats_.clients = 0;
+}
+
+DaemonStats MotionDaemon::stats() const {
+  std::lock_guard<std::mutex> lk(stats_mu_);
+  return stats_;
+}
+
+void MotionDaemon::loop() {
+  std::vector<pollfd> fds;
+  std::vector<Request> batch;
+
+  while (!stop_) {
+    fds.clear();
+    fds.push_back({listen_fd_, POLLIN, 0});
+    fds.push_back({wake_fd_, POLLIN, 0});
+    for (const auto& c : clients_) {
+      fds.push_back({c->fd, (short)(POLLIN | (c->out.size() > c->out_off ? POLLOUT : 0)), 0});
+    }
+
+    if (::poll(fds.data(), fds.size(), -1) < 0) {
+      if (errno == EINTR) continue;
+      break;
+    }
+    if (fds[1].revents & POLLIN) {
+      std::uint64_t v;
+      (void)!::read(wake_fd_, &v, sizeof(v));
+    }
+    if (stop_) break;
+
+    // 1) 접속 수락 + 읽기 (fds 는 이번 반복 시작 시점의 clients_ 순서)
+    const std::size_t polled = clients_.size();
+    if (fds[0].revents & POLLIN) acceptClients();
+
+    batch.clear();
+    for (std::size_t k = 0; k < polled; ++k) {
+      if (fds[2 + k].revents & (POLLIN | POLLHUP | POLLERR)) {
+        if (!readClient(*clients_[k], batch)) clients_[k]->dead = true;
+      }
+    }
+
+    // 2) 배치 처리 + 발행
+    if (!batch.empty()) runBatch(batch);
+
+    // 감시 스레드가 넘긴 리로드 통지
+    std::vector<Notice> reloads;
+    {
+      std::lock_guard<std::mutex> lk(notice_mu_);
+      reloads.swap(reload_notices_);
+    }
+    for (const auto& n : reloads) broadcast(n);
+
+    // 3) 전송, 끊긴 연결 정리
+    for (auto& c : clients_) {
+      if (!c->dead && c->out.size() > c->out_off && !flushClient(*c)) c->dead = true;
+    }
+    const std::size_t before = clients_.size();
+    clients_.erase(std::remove_if(clients_.begin(), clients_.end(),
+                                  [](const std::unique_ptr<Client>& c) {
+                                    if (c->dead) ::close(c->fd);
+                                    return c->dead;
+                                  }),
+                   clients_.end());
+    if (before != clients_.size() || fds[0].revents & POLLIN) {
+      std::lock_guard<std::mutex> lk(stats_mu_);
+      stats_.clients = clients_.size();
+    }
+  }
+}
+
+void MotionDaemon::acceptClients() {
+  for (;;) {
+    const int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) return; // EAGAIN 또는 일시 오류: 다음 poll 에서 다시
+    auto c = std::make_unique<Client>();
+    c->fd = fd;
+    clients_.push_back(std::move(c));
+  }
+}
+
+bool MotionDaemon::readClient(Client& c, std::vector<Request>& batch) {
+  bool open = true;
+  char buf[kReadChunk];
+  for (;;) {
+    const ssize_t n = ::read(c.fd, buf, sizeof(buf));
+    if (n > 0) {
+      c.in.append(buf, (std::size_t)n);
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) open = false;
+    break;
+  }
+
+  // 완성된 요청만 잘라 배치에 추가 (끊긴 연결도 이미 도착한 요청은 처리)
+  std::size_t pos = 0;
+  while (c.in.size() - pos >= proto::kHeaderSize) {
+    const proto::Header h = proto::getHeader(c.in.data() + pos);
+    if (h.length > proto::kMaxBody) return false;
+    if (c.in.size() - pos - proto::kHeaderSize < h.length) break;
+    batch.push_back(Request{&c, h.seq, h.op, c.in.substr(pos + proto::kHeaderSize, h.length)});
+    pos += proto::kHeaderSize + h.length;
+  }
+  c.in.erase(0, pos);
+  return open;
+}
+
+void MotionDaemon::runBatch(std::vector<Request>& batch) {
+  Batch b;
+  for (const auto& r : batch) handle(b, r, r.client->out);
+  publishEdits(b);
+  for (const auto& n : b.notices) broadcast(n);
+
+  std::lock_guard<std::mutex> lk(stats_mu_);
+  stats_.requests += batch.size();
+  ++stats_.batches;
+}
+
+void MotionDaemon::handle(Batch& b, const Request& r, std::string& out) {
+  using proto::Op;
+  std::string body;
+  try {
+    proto::Reader in(r.body.data(), r.body.size());
+    proto::Writer w(body);
+
+    switch (r.op) {
+      case Op::List: {
+        const auto names = lib_.names();
+        w.u32((std::uint32_t)names.size());
+        for (const auto& n : names) w.str(n);
+        break;
+      }
+      case Op::Info: {
+        const MotionEditor& me = b.read(lib_, std::string(in.str()));
+        w.u64(lib_.generation());
+        w.u32((std::uint32_t)me.frameCount());
+        w.str(me.motionName());
+        w.str(me.motionType());
+        w.u32((std::uint32_t)me.motorIds().size());
+        for (int id : me.motorIds()) w.i32(id);
+        break;
+      }
+      case Op::StepNames: {
+        const MotionEditor& me = b.read(lib_, std::string(in.str()));
+        const auto names = me.listStepNameViews();
+        w.u32((std::uint32_t)names.size());
+        for (auto n : names) w.str(n);
+        break;
+      }
+      case Op::GetFrame: {
+        const MotionEditor& me = b.read(lib_, std::string(in.str()));
+        const std::string step(in.str());
+        auto sym = me.stringPool()->find(step);
+        const int idx = sym ? me.findFrameIndex(*sym) : -1;
+        if (idx < 0) throw std::runtime_error("MotionDaemon: step not found: " + step);
+        w.frame(me.frameAt((std::size_t)idx), me.isSelected((std::size_t)idx));
+        break;
+      }
+      case Op::GetFrames: {
+        const MotionEditor& me = b.read(lib_, std::string(in.str()));
+        const std::size_t first = std::min<std::size_t>(in.u32(), me.frameCount());
+        const std::size_t count = std::min<std::size_t>(in.u32(), me.frameCount() - first);
+        w.u32((std::uint32_t)count);
+        for (std::size_t i = first; i < first + count; ++i) w.frame(me.frameAt(i), me.isSelected(i));
+        break;
+      }
+      case Op::EditJoints: {
+        const std::string name(in.str());
+        const std::string step(in.str());
+        const std::uint32_t n = in.u32();
+        in.need((std::size_t)n * 12); // 개수 필드만 큰 요청으로 버퍼를 잡지 않도록
+        std::vector<DxlValue> values(n);
+        for (auto& dv : values) {
+          dv.id = in.i32();
+          dv.position = in.f64();
+        }
+        b.edit(lib_, name, [step, values](MotionEditor& me) { me.editJointIds(step, values); });
+        break;
+      }
+      case Op::SetTiming: {
+        const std::string name(in.str());
+        const std::string step(in.str());
+        const int time = in.i32();
+        const int delay = in.i32();
+        b.edit(lib_, name, [step, time, delay](MotionEditor& me) {
+          auto sym = me.stringPool()->find(step);
+          const int idx = sym ? me.findFrameIndex(*sym) : -1;
+          if (idx < 0) throw std::runtime_error("MotionDaemon: step not found: " + step);
+          me.setFrameTiming((std::size_t)idx, time, delay);
+        });
+        break;
+      }
+      case Op::Save: {
+        const std::string name(in.str());
+        b.read(lib_, name);
+        publishEdits(b, name); // 이 배치의 앞선 편집까지 저장
+        w.str(lib_.save(name));
+        b.view.erase(name);
+        b.notices.push_back(Notice{name, proto::NoticeKind::Saved, lib_.generation(), {}});
+        break;
+      }
+      case Op::Reload: {
+        const std::string name(in.str());
+        // 앞선 미발행 편집은 파일 내용으로 덮이므로 버림
+        if (b.dirty.erase(name)) b.dirty_order.erase(std::find(b.dirty_order.begin(), b.dirty_order.end(), name));
+        b.view.erase(name);
+        w.u32((std::uint32_t)lib_.reload(name));
+        b.notices.push_back(Notice{name, proto::NoticeKind::Reloaded, lib_.generation(), {}});
+        break;
+      }
+      case Op::Subscribe:
+        r.client->subscribed = in.u8() != 0;
+        break;
+      default:
+        throw std::runtime_error("MotionDaemon: unknown op: " + std::to_string((int)r.op));
+    }
+  } catch (const std::exception& e) {
+    proto::Message m(out, r.seq, r.op, 1);
+    m.body().str(e.what());
+    return;
+  }
+
+  proto::Message m(out, r.seq, r.op);
+  out += body;
+}
+
+void MotionDaemon::publishEdits(Batch& b, const std::string& only) {
+  for (auto it = b.dirty_order.begin(); it != b.dirty_order.end();) {
+    if (!only.empty() && *it != only) {
+      ++it;
+      continue;
+    }
+    auto d = b.dirty.find(*it);
+    Batch::Pending p = std::move(d->second);
+    b.dirty.erase(d);
+
+    std::shared_ptr<const MotionEditor> motion = std::move(p.motion);
+    while (!lib_.replace(*it, motion, p.base)) {
+      // 배치 도중 감시 스레드가 리로드를 발행함: 리로드 결과 위에 이 배치의 편집을 다시 적용
+      p.base = lib_.get(*it);
+      auto next = std::make_shared<MotionEditor>(*p.base);
+      for (const auto& op : p.ops) {
+        try {
+          op(*next);
+        } catch (const std::exception& e) {
+          b.notices.push_back(Notice{*it, proto::NoticeKind::EditDropped, lib_.generation(), e.what()});
+        }
+      }
+      motion = std::move(next);
+    }
+    b.view[*it] = std::move(motion);
+    b.notices.push_back(Notice{*it, proto::NoticeKind::Edited, lib_.generation(), {}});
+    {
+      std::lock_guard<std::mutex> lk(stats_mu_);
+      ++stats_.publishes;
+    }
+    it = b.dirty_order.erase(it);
+  }
+}
+
+void MotionDaemon::broadcast(const Notice& n) {
+  std::string msg;
+  {
+    proto::Message m(msg, 0, proto::Op::Notify);
+    proto::Writer w = m.body();
+    w.str(n.motion);
+    w.u8((std::uint8_t)n.kind);
+    w.u64(n.generation);
+    w.str(n.error);
+  }
+  for (auto& c : clients_) {
+    if (c->subscribed && !c->dead) c->out += msg;
+  }
+}
+
+bool MotionDaemon::flushClient(Client& c) {
+  while (c.out_off < c.out.size()) {
+    const ssize_t n = ::send(c.fd, c.out.data() + c.out_off, c.out.size() - c.out_off, MSG_NOSIGNAL);
+    if (n > 0) {
+      c.out_off += (std::size_t)n;
+      continue;
+    }
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+    return false;
+  }
+  if (c.out_off == c.out.size()) {
+    c.out.clear();
+    c.out_off = 0;
+  } else if (c.out_off > kReadChunk) {
+    c.out.erase(0, c.out_off);
+    c.out_off = 0;
+  }
+  // 읽지 않는 구독자가 메모리를 무한히 잡지 않도록
+  return c.out.size() - c.out_off <= opt_.max_output;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
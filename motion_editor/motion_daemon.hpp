@@ -0,0 +1,98 @@
+/*
+ * Motion Daemon
+ * @file motion_daemon.hpp
+ * Serves a MotionLibrary to local tools over a Unix domain socket
+ * (motion_protocol.hpp), so the GUI, tuning scripts and playback node share one
+ * parsed copy and one writer instead of each loading and saving the YAML.
+ *
+ * Key features:
+ * - One poll loop; every request that is already buffered on any connection is
+ *   handled as one batch, and the responses go out in one write per client
+ * - Reads come from the library's immutable snapshot (no lock, no copy)
+ * - Edits in a batch go to one copy-on-write working copy per motion and are
+ *   published once at the end of the batch (Save publishes first); if a hot
+ *   reload landed in between, the batch's edits are replayed on the reloaded motion
+ * - Subscribed clients get a notice per published edit, save and hot reload
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "motion_editor/motion_library.hpp"
+#include "motion_editor/motion_protocol.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct DaemonOptions {
+  std::string socket_path;                // 이미 있으면 지우고 새로 bind
+  std::size_t max_output{64u << 20};      // 클라이언트별 미전송 바이트 상한 (넘으면 연결 종료)
+  bool notify_reloads{true};              // 라이브러리 ReloadCallback 을 가져와 리로드도 통지
+};
+
+struct DaemonStats {
+  std::uint64_t requests{0};
+  std::uint64_t batches{0};
+  std::uint64_t publishes{0}; // 편집 발행 횟수 (배치당 모션별 1회)
+  std::size_t clients{0};     // 현재 연결 수
+};
+
+class MotionDaemon {
+public:
+  // lib 은 데몬보다 오래 살아야 함
+  MotionDaemon(MotionLibrary& lib, const DaemonOptions& opt);
+  ~MotionDaemon();
+
+  MotionDaemon(const MotionDaemon&) = delete;
+  MotionDaemon& operator=(const MotionDaemon&) = delete;
+
+  // 소켓을 열고 루프 스레드 시작 / 정지 (소켓 파일 삭제)
+  void start();
+  void stop();
+  bool running() const { return thread_.joinable(); }
+
+  DaemonStats stats() const;
+
+private:
+  struct Client;
+  struct Request;
+  struct Batch;
+  struct Notice {
+    std::string motion;
+    proto::NoticeKind kind;
+    std::uint64_t generation;
+    std::string error;
+  };
+
+  void loop();
+  void acceptClients();
+  bool readClient(Client& c, std::vector<Request>& batch); // false = 연결 종료
+  void runBatch(std::vector<Request>& batch);
+  void handle(Batch& b, const Request& r, std::string& out);
+  void publishEdits(Batch& b, const std::string& only = {});
+  void broadcast(const Notice& n);
+  bool flushClient(Client& c); // false = 연결 종료
+
+  MotionLibrary& lib_;
+  DaemonOptions opt_;
+
+  int listen_fd_{-1};
+  int wake_fd_{-1};         // stop / 리로드 통지 (eventfd)
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+  std::vector<std::unique_ptr<Client>> clients_; // 루프 스레드 전용
+
+  std::mutex notice_mu_;
+  std::vector<Notice> reload_notices_; // 감시 스레드 -> 루프 스레드
+
+  mutable std::mutex stats_mu_;
+  DaemonStats stats_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
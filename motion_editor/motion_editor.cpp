@@ -10,36 +10,136 @@
  * - List and retrieve frames by name
  * - Edit joint positions by joint name or ID
  * - Preserve unknown metadata (MetaBlob)
+ * - Selection bitset: set operations never copy frames; bulk edits detach only
+ *   the selected frames, and save writes the bits as Frame::selected
+ * - Lazy mode: a line scanner indexes frame headers and dxl byte ranges;
+ *   items it does not understand fall back to yaml-cpp at load time
  */
 
 #include "motion_editor/motion_editor.hpp"
+#include "motion_editor/profiler.hpp"
+#include "motion_editor/robit_robot.hpp"
+#include "motion_editor/zone_map.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <filesystem>
+#include <mutex>
 
 namespace ROBIT_HUMANOID_MOTION_EDITOR
 {
-MotionEditor::MotionEditor() {
-  // 기본 매핑  >> 수정해서 사용할 것
-  joint_to_id_ = {
-    {"rotate_torso", 22},
-    {"rotate_0",      0},
-    {"rotate_1",      1},
-    {"rotate_2",      2},
-    {"rotate_3",      3},
-    {"rotate_5",      5},
-  };
+// 기본 매핑은 robit_robot.hpp 의 컴파일 타임 테이블  >> 수정해서 사용할 것
+MotionEditor::MotionEditor()
+: MotionEditor(robit::kRobot.view()) {}
+
+MotionEditor::MotionEditor(const JointTableView& robot)
+: zones_(std::make_shared<JointZoneMap>()), robot_(robot) {
+  for (std::size_t i = 0; i < robot_.count; ++i) {
+    joint_to_id_[std::string(robot_.joints[i].name)] = robot_.joints[i].id;
+  }
+  rebuildJointSymbols();
 }
 
 MotionEditor::MotionEditor(const std::unordered_map<std::string,int>& joint_to_id)
-: joint_to_id_(joint_to_id) {}
+: zones_(std::make_shared<JointZoneMap>()), joint_to_id_(joint_to_id) {
+  rebuildJointSymbols();
+}
+
+void MotionEditor::setJointToId(const std::unordered_map<std::string,int>& m) {
+  joint_to_id_ = m;
+  robot_ = JointTableView{};
+  rebuildJointSymbols();
+}
+
+int MotionEditor::jointId(std::string_view joint_name) const {
+  if (robot_) return robot_.id(joint_name);
+  // 사용자 정의 매핑: 풀 조회로 std::string 생성 없이 해석
+  auto sym = pool_->find(joint_name);
+  if (!sym || sym->id >= joint_sym_to_id_.size()) return -1;
+  return joint_sym_to_id_[sym->id];
+}
+
+void MotionEditor::setStringPool(std::shared_ptr<StringPool> pool) {
+  if (!pool) throw std::runtime_error("MotionEditor: null string pool");
+  if (pool == pool_) return;
+  pool_ = std::move(pool);
+
+  // 프레임 이름 심볼 재등록 (프레임 자체는 공유 유지, 청크만 분리)
+  FrameStore& st = detachStore();
+  for (auto& chunk : st.chunks) {
+    if (chunk.use_count() > 1) chunk = std::make_shared<FrameChunk>(*chunk);
+    for (std::size_t k = 0; k < chunk->frames.size(); ++k) {
+      chunk->names[k] = pool_->intern(chunk->frames[k]->name);
+    }
+  }
+  rebuildJointSymbols();
+}
+
+void MotionEditor::rebuildJointSymbols() {
+  joint_sym_to_id_.clear();
+  for (const auto& [name, id] : joint_to_id_) {
+    const Symbol sym = pool_->intern(name);
+    if (sym.id >= joint_sym_to_id_.size()) joint_sym_to_id_.resize(sym.id + 1, -1);
+    joint_sym_to_id_[sym.id] = id;
+  }
+}
 
 static bool hasKey(const YAML::Node& n, const char* key) {
   return n.IsMap() && n[key];
 }
 
 void MotionEditor::loadFromFile(const std::string& path) {
-  meta_blobs_.clear();
-  frames_.clear();
+  MOTION_EDITOR_PROFILE_SCOPE(Load);
+  if (lazy_) {
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) throw std::runtime_error("MotionEditor: cannot open file: " + path);
+    std::string text((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    loadLazy(std::move(text));
+    return;
+  }
+  std::error_code ec;
+  const auto bytes = std::filesystem::file_size(path, ec);
+  YAML::Node root;
+  {
+    MOTION_EDITOR_PROFILE_SCOPE(LoadParse);
+    root = YAML::LoadFile(path);
+  }
+  loadFromNode(root, ec ? 0 : (std::size_t)bytes);
+}
+
+void MotionEditor::loadFromString(const std::string& yaml_text) {
+  MOTION_EDITOR_PROFILE_SCOPE(Load);
+  if (lazy_) {
+    loadLazy(yaml_text);
+    return;
+  }
+  YAML::Node root;
+  {
+    MOTION_EDITOR_PROFILE_SCOPE(LoadParse);
+    root = YAML::Load(yaml_text);
+  }
+  loadFromNode(root, yaml_text.size());
+}
+
+void MotionEditor::loadFromNode(const YAML::Node& root, std::size_t size_hint) {
+  MOTION_EDITOR_PROFILE_SCOPE(LoadExtract);
+  // 새 저장소에 채운 뒤 교체 (이 편집기와 공유 중인 변형체는 이전 데이터를 그대로 유지)
+  auto metas = std::make_shared<MetaList>();
+  auto store = std::make_shared<FrameStore>();
+  auto zones = std::make_shared<JointZoneMap>();
+  auto selection = std::make_shared<FrameSelection>();
+
+  // 아레나 모드: 파일 크기로 첫 블록을 잡아 두면 로드 전체가 블록 몇 개로 끝남
+  std::pmr::memory_resource* mr = std::pmr::get_default_resource();
+  if (use_arena_) {
+    const std::size_t initial = size_hint ? std::max<std::size_t>(size_hint / 2, 4096) : 64 * 1024;
+    auto arena = std::make_shared<std::pmr::monotonic_buffer_resource>(initial);
+    mr = arena.get();
+    store->arena = std::move(arena);
+  }
+  const std::pmr::polymorphic_allocator<Frame> frame_alloc(mr);
 
-  YAML::Node root = YAML::LoadFile(path);
   if (!root || !root.IsSequence()) {
     throw std::runtime_error("MotionEditor: top-level must be a YAML sequence.");
   }
@@ -50,106 +150,384 @@ void MotionEditor::loadFromFile(const std::string& path) {
       hasKey(item, "dxl") && hasKey(item, "time") && hasKey(item, "name");
 
     if (appearsFrame) {
-      // parse frame
-      Frame f = parseFrameFromNode(item);
-      frames_.push_back(std::move(f));
-    } else {
-      // 메타 블롭으로 보존 (round-trip을 위해 문자열로 덤프)
-      MetaBlob mb;
-      std::stringstream ss;
-      ss << item;
-      mb.rawYaml = ss.str();
-      meta_blobs_.push_back(std::move(mb));
+      // parse frame (motor id 메타가 앞서 나왔으면 그 순서/개수로 dxl 배치)
+      const std::vector<int>* order = metas->motor_ids.empty() ? nullptr : &metas->motor_ids;
+      auto f = std::allocate_shared<Frame>(frame_alloc, parseFrameFromNode(item, mr, order));
+      zones->appendFrame(*f);
+      selection->push_back(f->selected);
+      const Symbol name = pool_->intern(f->name);
+      pushFrame(*store, std::move(f), name);
+    } else if (!parseKnownMeta(item, *metas)) {
+      // 모르는 메타는 노드째 보존 (문서 전체 메모리를 붙잡지 않도록 복제)
+      metas->items.push_back(MetaBlob{MetaKind::Unknown, YAML::Clone(item)});
     }
   }
+
+  meta_blobs_ = std::move(metas);
+  store_ = std::move(store);
+  zones_ = std::move(zones);
+  selection_ = std::move(selection);
 }
 
 void MotionEditor::saveToFile(const std::string& path) const {
-  YAML::Node out = buildYamlFromAll(meta_blobs_, frames_);
+  MOTION_EDITOR_PROFILE_SCOPE(Save);
+  loadPendingFrames();
+  YAML::Node out = buildYamlFromAll(*meta_blobs_, *store_, *selection_);
   std::ofstream ofs(path);
   if (!ofs) throw std::runtime_error("MotionEditor: cannot open file to write: " + path);
+  MOTION_EDITOR_PROFILE_SCOPE(SaveEmit);
   ofs << out; // yaml-cpp emits nice flow
 }
 
 std::vector<std::string> MotionEditor::listStepNames() const {
+  MOTION_EDITOR_PROFILE_SCOPE(ListStepNames);
   std::vector<std::string> names;
-  names.reserve(frames_.size());
-  for (const auto& f : frames_) names.push_back(f.name);
+  names.reserve(frameCount());
+  for (std::size_t i = 0; i < frameCount(); ++i) names.push_back(frameHeaderAt(i).name); // 지연 프레임 파싱 없음
+  return names;
+}
+
+std::vector<std::string_view> MotionEditor::listStepNameViews() const {
+  MOTION_EDITOR_PROFILE_SCOPE(ListStepNames);
+  std::vector<std::string_view> names;
+  names.reserve(frameCount());
+  for (const auto& chunk : store_->chunks) {
+    for (Symbol sym : chunk->names) names.push_back(pool_->view(sym));
+  }
   return names;
 }
 
 std::optional<Frame> MotionEditor::getFrame(const std::string& step_name) const {
+  MOTION_EDITOR_PROFILE_SCOPE(GetFrame);
   int idx = findFrameIndexByName(step_name);
   if (idx < 0) return std::nullopt;
-  return frames_[idx];
+  Frame f = frameAt(idx);
+  f.selected = isSelected(idx); // 로드 당시 값이 아닌 현재 선택 상태
+  return f;
 }
 
 void MotionEditor::editFourArmJoints(const std::string& step_name,
                                      const JointPosMap& joint_positions_rad) {
-  JointPosMap sub;
-  auto put = [&](const char* j){
-    auto it = joint_positions_rad.find(j);
-    if (it != joint_positions_rad.end()) sub[j] = it->second;
-  };
-  put("rotate_torso");
-  put("rotate_0");
-  put("rotate_1");
-  put("rotate_2");
-  put("rotate_3");
-  put("rotate_5");
-
-  if (sub.empty()) return; // 바꿀게 없으면 조용히 반환
-  editJoints(step_name, sub, false);
+  MOTION_EDITOR_PROFILE_SCOPE(EditJoints);
+  // 그룹 관절만 골라 반영 (임시 JointPosMap 없이 그룹 상수로 필터링)
+  int idx = -1;
+  for (const auto& [jname, qrad] : joint_positions_rad) {
+    if (!robit::kArmGroup.contains(jname)) continue;
+    if (idx < 0) {
+      MOTION_EDITOR_PROFILE_SCOPE(EditLookup);
+      idx = findFrameIndexByName(step_name);
+      if (idx < 0) throw std::runtime_error("MotionEditor: step not found: " + step_name);
+    }
+    const int id = jointId(jname);
+    if (id < 0) continue;
+    setDxlPosition(idx, detachFrame(idx), id, qrad);
+  }
+  // 바꿀게 없으면 조용히 반환
 }
 
 void MotionEditor::editJoints(const std::string& step_name,
                               const JointPosMap& joint_positions_rad,
                               bool strict) {
-  int idx = findFrameIndexByName(step_name);
+  MOTION_EDITOR_PROFILE_SCOPE(EditJoints);
+  int idx;
+  {
+    MOTION_EDITOR_PROFILE_SCOPE(EditLookup);
+    idx = findFrameIndexByName(step_name);
+  }
   if (idx < 0) throw std::runtime_error("MotionEditor: step not found: " + step_name);
 
-  Frame& f = frames_[idx];
-
-  // id -> dxl 포인터 맵 만들기 (빠른 갱신)
-  std::unordered_map<int, DxlValue*> id2dxl;
-  id2dxl.reserve(f.dxl.size());
-  for (auto& dv : f.dxl) id2dxl[dv.id] = &dv;
+  MOTION_EDITOR_PROFILE_SCOPE(EditUpdate);
+  Frame& f = detachFrame(idx); // 공유 중이면 이 프레임만 복사
 
   for (const auto& [jname, qrad] : joint_positions_rad) {
-    auto it = joint_to_id_.find(jname);
-    if (it == joint_to_id_.end()) {
+    const int id = jointId(jname);
+    if (id < 0) {
       if (strict) throw std::runtime_error("Unknown joint name: " + jname);
       else continue; // 모르는 조인트명은 무시
     }
-    int id = it->second;
+    setDxlPosition(idx, f, id, qrad);
+  }
+}
 
-    auto it2 = id2dxl.find(id);
-    if (it2 == id2dxl.end()) {
-      // 해당 프레임 dxl에 없으면 새로 추가(일부 파일에 특정 id가 빠져있을 수도 있으므로)
-      DxlValue dv; dv.id = id; dv.position = qrad;
-      f.dxl.push_back(dv);
-      id2dxl[id] = &f.dxl.back();
-    } else {
-      it2->second->position = qrad;
+void MotionEditor::editJointIds(const std::string& step_name, const std::vector<DxlValue>& values) {
+  MOTION_EDITOR_PROFILE_SCOPE(EditJoints);
+  int idx;
+  {
+    MOTION_EDITOR_PROFILE_SCOPE(EditLookup);
+    idx = findFrameIndexByName(step_name);
+  }
+  if (idx < 0) throw std::runtime_error("MotionEditor: step not found: " + step_name);
+
+  MOTION_EDITOR_PROFILE_SCOPE(EditUpdate);
+  Frame& f = detachFrame(idx);
+  for (const auto& dv : values) setDxlPosition(idx, f, dv.id, dv.position);
+}
+
+void MotionEditor::editJointIdsAt(std::size_t i, const std::vector<DxlValue>& values) {
+  MOTION_EDITOR_PROFILE_SCOPE(EditJoints);
+  if (i >= frameCount()) throw std::out_of_range("MotionEditor: editJointIdsAt index out of range");
+
+  MOTION_EDITOR_PROFILE_SCOPE(EditUpdate);
+  Frame& f = detachFrame(i);
+  for (const auto& dv : values) setDxlPosition(i, f, dv.id, dv.position);
+}
+
+void MotionEditor::editJoints(Symbol step,
+                              const std::vector<JointSymValue>& joint_positions_rad,
+                              bool strict) {
+  MOTION_EDITOR_PROFILE_SCOPE(EditJoints);
+  int idx;
+  {
+    MOTION_EDITOR_PROFILE_SCOPE(EditLookup);
+    idx = findFrameIndex(step);
+  }
+  if (idx < 0) {
+    throw std::runtime_error("MotionEditor: step not found: " + std::string(pool_->view(step)));
+  }
+
+  MOTION_EDITOR_PROFILE_SCOPE(EditUpdate);
+  Frame& f = detachFrame(idx);
+  for (const auto& jv : joint_positions_rad) {
+    const int id = (jv.joint.id < joint_sym_to_id_.size()) ? joint_sym_to_id_[jv.joint.id] : -1;
+    if (id < 0) {
+      if (strict) throw std::runtime_error("Unknown joint name: " + std::string(pool_->view(jv.joint)));
+      else continue;
     }
+    setDxlPosition(idx, f, id, jv.position);
   }
 }
 
+void MotionEditor::setDxlPosition(std::size_t i, Frame& f, int id, double position) {
+  // 관절 수가 적어 선형 탐색이 해시 맵 구성보다 빠름
+  for (auto& dv : f.dxl) {
+    if (dv.id == id) {
+      mutableZones().setValue(i, id, dv.position, true, position);
+      dv.position = position;
+      return;
+    }
+  }
+  // 해당 프레임 dxl에 없으면 새로 추가(일부 파일에 특정 id가 빠져있을 수도 있으므로)
+  DxlValue dv; dv.id = id; dv.position = position;
+  f.dxl.push_back(dv);
+  mutableZones().setValue(i, id, 0.0, false, position);
+}
+
+bool MotionEditor::setFrameTiming(std::size_t i, std::optional<int> time, std::optional<int> delay) {
+  if (i >= frameCount()) throw std::out_of_range("MotionEditor: setFrameTiming index out of range");
+  const Frame& cur = frameHeaderAt(i);
+  if ((!time || cur.time == *time) && (!delay || cur.delay == *delay)) return false;
+  Frame& f = detachFrame(i); // 관절 값은 그대로라 구역 요약 갱신 없음
+  if (time) f.time = *time;
+  if (delay) f.delay = *delay;
+  return true;
+}
+
+void MotionEditor::renameFrame(std::size_t i, const std::string& name) {
+  detachFrame(i).name = name; // 저장소/청크 분리까지 끝난 상태
+  store_->chunks[i >> kChunkBits]->names[i & kChunkMask] = pool_->intern(name);
+}
+
 bool MotionEditor::approxEqual(double a, double b, double eps) {
   return std::abs(a-b) <= eps * std::max(1.0, std::max(std::abs(a), std::abs(b)));
 }
 
 int MotionEditor::findFrameIndexByName(const std::string& step_name) const {
-  for (int i=0; i<(int)frames_.size(); ++i) {
-    if (frames_[i].name == step_name) return i;
+  // 풀에 없는 이름이면 어떤 프레임에도 없음
+  auto sym = pool_->find(step_name);
+  return sym ? findFrameIndex(*sym) : -1;
+}
+
+int MotionEditor::findFrameIndex(Symbol step) const {
+  int i = 0;
+  for (const auto& chunk : store_->chunks) {
+    for (Symbol sym : chunk->names) {
+      if (sym == step) return i;
+      ++i;
+    }
   }
   return -1;
 }
 
+// ===== 관절 값 범위 조회 =====
+
+JointStats MotionEditor::jointStats(int motor_id) const {
+  return zones_->stats(*this, motor_id);
+}
+
+JointStats MotionEditor::jointStats(std::string_view joint_name) const {
+  return jointStats(jointId(joint_name));
+}
+
+std::vector<std::size_t> MotionEditor::findFramesInRange(int motor_id, double lo, double hi) const {
+  std::vector<std::size_t> out;
+  zones_->findFrames(*this, motor_id, lo, hi, out);
+  return out;
+}
+
+std::vector<std::size_t> MotionEditor::findFramesInRange(std::string_view joint_name,
+                                                         double lo, double hi) const {
+  return findFramesInRange(jointId(joint_name), lo, hi);
+}
+
+// ===== Copy-on-write 저장소 =====
+
+MotionEditor::FrameStore& MotionEditor::detachStore() {
+  // 다른 편집기와 공유 중이면 청크 포인터 목록만 복사 (프레임은 그대로 공유)
+  if (store_.use_count() > 1) store_ = std::make_shared<FrameStore>(*store_);
+  return *store_;
+}
+
+Frame& MotionEditor::mutableFrameAt(std::size_t i) {
+  // 호출자가 무엇을 바꿀지 모르므로 해당 블록 요약은 다음 조회 때 재계산
+  mutableZones().markDirty(i);
+  return detachFrame(i);
+}
+
+Frame& MotionEditor::detachFrame(std::size_t i) {
+  FrameStore& st = detachStore();
+
+  auto& chunk = st.chunks[i >> kChunkBits];
+  if (chunk.use_count() > 1) chunk = std::make_shared<FrameChunk>(*chunk);
+  if (!chunk->lazy.empty()) {
+    ensureLoaded(*chunk, i & kChunkMask); // 복사/편집 전에 dxl 파싱
+    chunk->lazy[i & kChunkMask] = kNotLazy;
+  }
+
+  auto& frame = chunk->frames[i & kChunkMask];
+  if (frame.use_count() > 1) frame = std::make_shared<Frame>(*frame);
+  return *frame;
+}
+
+void MotionEditor::appendFrame(Frame f) {
+  FrameStore& st = detachStore();
+  if (!st.chunks.empty() && st.chunks.back().use_count() > 1) {
+    st.chunks.back() = std::make_shared<FrameChunk>(*st.chunks.back());
+  }
+  const Symbol name = pool_->intern(f.name);
+  mutableZones().appendFrame(f);
+  mutableSelection().push_back(f.selected);
+  pushFrame(st, std::make_shared<Frame>(std::move(f)), name);
+}
+
+void MotionEditor::clearFrames() {
+  store_ = std::make_shared<FrameStore>();
+  zones_ = std::make_shared<JointZoneMap>();
+  selection_ = std::make_shared<FrameSelection>();
+}
+
+JointZoneMap& MotionEditor::mutableZones() {
+  if (zones_.use_count() > 1) zones_ = std::make_shared<JointZoneMap>(*zones_);
+  return *zones_;
+}
+
+FrameSelection& MotionEditor::mutableSelection() {
+  if (selection_.use_count() > 1) selection_ = std::make_shared<FrameSelection>(*selection_);
+  return *selection_;
+}
+
+void MotionEditor::replaceFrame(std::size_t i, Frame f) {
+  if (i >= frameCount()) throw std::out_of_range("MotionEditor: replaceFrame index out of range");
+  FrameStore& st = detachStore();
+  auto& chunk = st.chunks[i >> kChunkBits];
+  if (chunk.use_count() > 1) chunk = std::make_shared<FrameChunk>(*chunk);
+  chunk->names[i & kChunkMask] = pool_->intern(f.name);
+  mutableSelection().set(i, f.selected);
+  const std::size_t k = i & kChunkMask;
+  if (!chunk->lazy.empty()) dropLazySlot(*chunk, k);
+  chunk->frames[k] = std::make_shared<Frame>(std::move(f));
+  mutableZones().markDirty(i);
+}
+
+void MotionEditor::pushFrame(FrameStore& store, std::shared_ptr<Frame> f, Symbol name) {
+  if (store.chunks.empty() || store.chunks.back()->frames.size() == kChunkSize) {
+    store.chunks.push_back(std::make_shared<FrameChunk>());
+    store.chunks.back()->frames.reserve(kChunkSize);
+    store.chunks.back()->names.reserve(kChunkSize);
+  }
+  store.chunks.back()->frames.push_back(std::move(f));
+  store.chunks.back()->names.push_back(name);
+  if (!store.chunks.back()->lazy.empty()) store.chunks.back()->lazy.push_back(kNotLazy);
+  ++store.count;
+}
+
+// ===== 메타 항목 =====
+
+bool MotionEditor::parseKnownMeta(const YAML::Node& item, MetaList& metas) {
+  // 키 하나짜리 맵만 알려진 메타로 취급
+  if (!item.IsMap() || item.size() != 1) return false;
+  const auto kv = item.begin();
+  if (!kv->first.IsScalar()) return false;
+  const std::string key = kv->first.as<std::string>();
+  const YAML::Node v = kv->second;
+
+  if (key == "name" && v.IsScalar()) {
+    metas.motion_name = v.as<std::string>();
+    metas.items.push_back(MetaBlob{MetaKind::MotionName, {}});
+  } else if (key == "type" && v.IsScalar()) {
+    metas.type = v.as<std::string>();
+    metas.items.push_back(MetaBlob{MetaKind::Type, {}});
+  } else if (key == "motor id" && v.IsSequence()) {
+    // 원소가 모두 정수일 때만 타입 항목으로, 아니면 모르는 메타로 그대로 보존
+    std::vector<int> ids;
+    ids.reserve(v.size());
+    for (const auto& e : v) {
+      int id;
+      if (!e.IsScalar() || !YAML::convert<int>::decode(e, id)) return false;
+      ids.push_back(id);
+    }
+    metas.motor_ids = std::move(ids);
+    metas.items.push_back(MetaBlob{MetaKind::MotorIds, {}});
+  } else {
+    return false;
+  }
+  return true;
+}
+
+MotionEditor::MetaList& MotionEditor::mutableMeta() {
+  // 메타는 작으므로 공유 중이면 통째로 복사
+  if (meta_blobs_.use_count() > 1) meta_blobs_ = std::make_shared<MetaList>(*meta_blobs_);
+  return *meta_blobs_;
+}
+
+void MotionEditor::setMotionName(const std::string& name) {
+  MetaList& m = mutableMeta();
+  m.motion_name = name;
+  auto it = std::find_if(m.items.begin(), m.items.end(),
+                         [](const MetaBlob& b) { return b.kind == MetaKind::MotionName; });
+  if (it == m.items.end()) m.items.push_back(MetaBlob{MetaKind::MotionName, {}});
+}
+
+void MotionEditor::setMotionType(const std::string& type) {
+  MetaList& m = mutableMeta();
+  m.type = type;
+  auto it = std::find_if(m.items.begin(), m.items.end(),
+                         [](const MetaBlob& b) { return b.kind == MetaKind::Type; });
+  if (it == m.items.end()) m.items.push_back(MetaBlob{MetaKind::Type, {}});
+}
+
+void MotionEditor::setMotorIds(const std::vector<int>& ids) {
+  MetaList& m = mutableMeta();
+  m.motor_ids = ids;
+  auto it = std::find_if(m.items.begin(), m.items.end(),
+                         [](const MetaBlob& b) { return b.kind == MetaKind::MotorIds; });
+  if (it == m.items.end()) m.items.push_back(MetaBlob{MetaKind::MotorIds, {}});
+}
+
 // ===== YAML 변환 유틸 =====
 
-Frame MotionEditor::parseFrameFromNode(const YAML::Node& n) {
-  Frame f;
+Frame MotionEditor::parseFrame(const std::string& yaml_text, const std::vector<int>* motor_order) {
+  YAML::Node n = YAML::Load(yaml_text);
+  if (n.IsSequence() && n.size() == 1) n = n[0];
+  if (!hasKey(n, "dxl") || !hasKey(n, "time") || !hasKey(n, "name")) {
+    throw std::runtime_error("MotionEditor: text is not a frame item");
+  }
+  return parseFrameFromNode(n, std::pmr::get_default_resource(), motor_order);
+}
+
+Frame MotionEditor::parseFrameFromNode(const YAML::Node& n, std::pmr::memory_resource* mr,
+                                       const std::vector<int>* motor_order) {
+  MOTION_EDITOR_PROFILE_SCOPE(ParseFrame);
+  Frame f(mr);
   if (n["time"])     f.time = n["time"].as<int>();
   if (n["delay"])    f.delay = n["delay"].as<int>();
   if (n["repeat"])   f.repeat = n["repeat"].as<int>();
@@ -159,50 +537,557 @@ Frame MotionEditor::parseFrameFromNode(const YAML::Node& n) {
   if (!n["dxl"] || !n["dxl"].IsSequence()) {
     throw std::runtime_error("MotionEditor: frame missing 'dxl' sequence: " + f.name);
   }
+  parseDxlFromNode(n["dxl"], f, motor_order);
+  return f;
+}
 
-  for (const auto& elem : n["dxl"]) {
+void MotionEditor::parseDxlFromNode(const YAML::Node& dxl, Frame& f, const std::vector<int>* motor_order) {
+  f.dxl.reserve(std::max<std::size_t>(dxl.size(), motor_order ? motor_order->size() : 0));
+  for (const auto& elem : dxl) {
     if (!elem.IsMap()) continue;
     DxlValue dv;
     dv.id = elem["id"].as<int>();
     dv.position = elem["position"].as<double>();
     f.dxl.push_back(dv);
   }
-  return f;
+
+  // motor id 목록 순서로 정렬 (목록에 없는 id는 원래 순서대로 뒤에)
+  // 보통 파일이 이미 같은 순서라 확인만 하고 끝남
+  if (motor_order) {
+    const std::vector<int>& order = *motor_order;
+    bool in_order = f.dxl.size() <= order.size();
+    for (std::size_t k = 0; in_order && k < f.dxl.size(); ++k) in_order = (f.dxl[k].id == order[k]);
+    if (!in_order) {
+      auto rank = [&](int id) {
+        auto it = std::find(order.begin(), order.end(), id);
+        return (std::size_t)(it - order.begin()); // 없으면 order.size()
+      };
+      std::stable_sort(f.dxl.begin(), f.dxl.end(),
+                       [&](const DxlValue& a, const DxlValue& b) { return rank(a.id) < rank(b.id); });
+    }
+  }
+}
+
+void MotionEditor::appendMetaNodes(YAML::Node& seq) const {
+  appendMetaNodes(*meta_blobs_, seq);
+}
+
+void MotionEditor::appendMetaNodes(const MetaList& metas, YAML::Node& seq) {
+  // 알려진 메타는 타입 필드로부터, 나머지는 보관한 노드로 구성 (재파싱 없음)
+  for (const auto& mb : metas.items) {
+    YAML::Node m;
+    switch (mb.kind) {
+      case MetaKind::MotionName: m["name"] = metas.motion_name; break;
+      case MetaKind::Type:       m["type"] = metas.type; break;
+      case MetaKind::MotorIds: {
+        YAML::Node ids(YAML::NodeType::Sequence);
+        for (int id : metas.motor_ids) ids.push_back(id);
+        m["motor id"] = ids;
+        break;
+      }
+      case MetaKind::Unknown:
+        // 공유 노드를 출력 문서에 병합하지 않도록 복제 (파싱보다 훨씬 쌈)
+        m = YAML::Clone(mb.node);
+        break;
+    }
+    seq.push_back(m);
+  }
+}
+
+YAML::Node MotionEditor::frameToNode(const Frame& f) {
+  YAML::Node node;
+  node["time"]     = f.time;
+  node["delay"]    = f.delay;
+  node["repeat"]   = f.repeat;
+  node["name"]     = f.name;
+  node["selected"] = f.selected;
+
+  YAML::Node dxl_node(YAML::NodeType::Sequence);
+  for (const auto& dv : f.dxl) {
+    YAML::Node one;
+    one["id"] = dv.id;
+    one["position"] = dv.position;
+    dxl_node.push_back(one);
+  }
+  node["dxl"] = dxl_node;
+  return node;
 }
 
-YAML::Node MotionEditor::buildYamlFromAll(const std::vector<MetaBlob>& metas,
-                                          const std::vector<Frame>& frames) {
+YAML::Node MotionEditor::buildYamlFromAll(const MetaList& metas,
+                                          const FrameStore& frames,
+                                          const FrameSelection& selection) {
+  MOTION_EDITOR_PROFILE_SCOPE(SaveBuild);
   YAML::Node out(YAML::NodeType::Sequence);
 
-  // 메타 항목들(로드한 rawYaml 그대로 다시 파싱해서 삽입)
-  for (const auto& mb : metas) {
-    YAML::Node m = YAML::Load(mb.rawYaml);
-    out.push_back(m);
+  // 메타 항목들
+  appendMetaNodes(metas, out);
+
+  // 프레임들 (selected 는 선택 비트셋 기준)
+  std::size_t i = 0;
+  for (const auto& chunk : frames.chunks) {
+    for (const auto& f : chunk->frames) {
+      YAML::Node node = frameToNode(*f);
+      if (selection.test(i) != f->selected) node["selected"] = selection.test(i);
+      out.push_back(node);
+      ++i;
+    }
   }
 
-  // 프레임들
-  for (const auto& f : frames) {
-    YAML::Node node;
-    node["time"]     = f.time;
-    node["delay"]    = f.delay;
-    node["repeat"]   = f.repeat;
-    node["name"]     = f.name;
-    node["selected"] = f.selected;
+  return out;
+}
+
+// ===== 프레임 선택 =====
+
+void MotionEditor::setSelection(FrameSelection sel) {
+  if (sel.size() != frameCount()) {
+    throw std::runtime_error("MotionEditor: selection size " + std::to_string(sel.size()) +
+                             " does not match frame count " + std::to_string(frameCount()));
+  }
+  selection_ = std::make_shared<FrameSelection>(std::move(sel));
+}
+
+void MotionEditor::select(std::size_t i, bool on) {
+  if (i >= frameCount()) throw std::out_of_range("MotionEditor: select index out of range");
+  mutableSelection().set(i, on);
+}
+
+void MotionEditor::selectRange(std::size_t first, std::size_t last, bool on) {
+  mutableSelection().setRange(first, last, on);
+}
+
+void MotionEditor::selectAll() {
+  mutableSelection().setAll(true);
+}
 
-    YAML::Node dxl_node(YAML::NodeType::Sequence);
-    for (const auto& dv : f.dxl) {
-      YAML::Node one;
-      one["id"] = dv.id;
-      one["position"] = dv.position;
-      dxl_node.push_back(one);
+void MotionEditor::clearSelection() {
+  mutableSelection().setAll(false);
+}
+
+void MotionEditor::invertSelection() {
+  mutableSelection().invert();
+}
+
+std::size_t MotionEditor::editSelectedJoints(BulkJointOp op, const std::vector<DxlValue>& values) {
+  MOTION_EDITOR_PROFILE_SCOPE(EditSelected);
+  std::size_t changed = 0;
+  if (values.empty()) return 0;
+  // 선택 비트만 훑으며 프레임마다 분리 1회 + 관절 값 반영 (구역 요약은 값 단위로 갱신)
+  selection_->forEach([&](std::size_t i) {
+    if (op != BulkJointOp::Set) {
+      // Offset/Scale 은 대상 관절이 있는 프레임만 분리 (나머지는 복제본과 공유 유지)
+      const Frame& cur = frameAt(i);
+      const bool applies = std::any_of(values.begin(), values.end(), [&](const DxlValue& v) {
+        return std::any_of(cur.dxl.begin(), cur.dxl.end(), [&](const DxlValue& dv) { return dv.id == v.id; });
+      });
+      if (!applies) return;
     }
-    node["dxl"] = dxl_node;
+    Frame& f = detachFrame(i);
+    bool touched = false;
+    for (const auto& v : values) {
+      if (op == BulkJointOp::Set) {
+        setDxlPosition(i, f, v.id, v.position);
+        touched = true;
+        continue;
+      }
+      for (auto& dv : f.dxl) {
+        if (dv.id != v.id) continue;
+        const double q = (op == BulkJointOp::Offset) ? dv.position + v.position : dv.position * v.position;
+        mutableZones().setValue(i, dv.id, dv.position, true, q);
+        dv.position = q;
+        touched = true;
+        break;
+      }
+    }
+    if (touched) ++changed;
+  });
+  return changed;
+}
 
-    out.push_back(node);
+std::size_t MotionEditor::editSelectedJoints(BulkJointOp op, const JointPosMap& values, bool strict) {
+  std::vector<DxlValue> ids;
+  ids.reserve(values.size());
+  for (const auto& [jname, v] : values) {
+    const int id = jointId(jname);
+    if (id < 0) {
+      if (strict) throw std::runtime_error("Unknown joint name: " + jname);
+      else continue;
+    }
+    ids.push_back(DxlValue{id, v});
   }
+  return editSelectedJoints(op, ids);
+}
 
-  return out;
+std::size_t MotionEditor::setSelectedTiming(std::optional<int> time, std::optional<int> delay) {
+  MOTION_EDITOR_PROFILE_SCOPE(EditSelected);
+  std::size_t changed = 0;
+  if (!time && !delay) return 0;
+  selection_->forEach([&](std::size_t i) {
+    if (setFrameTiming(i, time, delay)) ++changed;
+  });
+  return changed;
 }
 
-} // namespace ROBIT_HUMANOID_MOTION_EDITOR
+void MotionEditor::applySelectionToFrames() {
+  for (std::size_t i = 0; i < frameCount(); ++i) {
+    const bool on = selection_->test(i);
+    if (frameHeaderAt(i).selected != on) detachFrame(i).selected = on;
+  }
+}
+
+// ===== 지연 로드 =====
+
+struct MotionEditor::LazyDxl {
+  struct Range {
+    std::size_t begin; // "dxl:" 키 위치
+    std::size_t end;
+    bool ordered;      // 로드 시 motor id 메타가 이 프레임보다 앞에 있었는지
+  };
+  std::string text;    // 파일 원문 (모든 항목을 파싱하면 해제)
+  std::vector<Range> ranges;
+  std::vector<int> motor_order;
+  std::unique_ptr<std::atomic<bool>[]> parsed;
+  std::size_t remaining{0};
+  std::mutex mu;       // dxl 파싱끼리만 직렬화, 이미 파싱된 프레임 읽기는 잠금 없음
+};
+
+namespace {
+struct TextItem {
+  std::size_t begin;
+  std::size_t end;
+};
+
+struct HeaderScan {
+  bool ok{true};
+  bool has_time{false};
+  bool has_name{false};
+  bool has_dxl{false};
+  std::size_t dxl_begin{0};
+  std::size_t dxl_end{0};
+};
+
+std::string_view lineAt(const std::string& text, std::size_t pos, std::size_t end, std::size_t& eol) {
+  eol = text.find('\n', pos);
+  if (eol == std::string::npos || eol > end) eol = end;
+  std::string_view line(text.data() + pos, eol - pos);
+  if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+  return line;
+}
+
+bool startsWith(std::string_view s, std::string_view p) {
+  return s.size() >= p.size() && s.compare(0, p.size(), p) == 0;
+}
+
+bool isItemStart(std::string_view line) {
+  return line == "-" || startsWith(line, "- ");
+}
+
+// 블록 스타일 최상위 시퀀스를 항목 단위로 분할 (아니면 false -> 일반 로드)
+bool splitTopLevel(const std::string& text, std::vector<TextItem>& items) {
+  std::size_t pos = 0, eol = 0;
+  while (pos < text.size()) {
+    const std::string_view line = lineAt(text, pos, text.size(), eol);
+    const std::size_t indent = line.find_first_not_of(' ');
+    if (isItemStart(line)) {
+      if (!items.empty()) items.back().end = pos;
+      items.push_back(TextItem{pos, text.size()});
+    } else if (indent != std::string_view::npos && line[indent] != '#') {
+      // 들여쓴 줄은 항목 안에서만, 최상위에는 문서 시작 표시만 허용
+      // (여러 문서, 플로우/맵 최상위 등은 yaml-cpp 로)
+      if (indent == 0 ? !(items.empty() && line == "---") : items.empty()) return false;
+    }
+    pos = eol + 1;
+  }
+  return true;
+}
+
+// 한 줄짜리 스칼라 값 (따옴표/주석 처리). 별칭/태그/블록 스칼라/이스케이프 등은 false
+bool scalarValue(std::string_view v, std::string& out) {
+  if (v.empty()) return false;
+  if (v.front() == '"' || v.front() == '\'') {
+    const char q = v.front();
+    std::size_t close = 1;
+    out.clear();
+    for (;; ++close) {
+      if (close >= v.size()) return false;
+      if (v[close] == '\\' && q == '"') return false;
+      if (v[close] == q) {
+        if (q == '\'' && close + 1 < v.size() && v[close + 1] == '\'') {
+          out += '\'';
+          ++close;
+          continue;
+        }
+        break;
+      }
+      out += v[close];
+    }
+    std::string_view rest = v.substr(close + 1);
+    while (!rest.empty() && rest.front() == ' ') rest.remove_prefix(1);
+    return rest.empty() || rest.front() == '#';
+  }
+  if (std::string_view("[{&*!|>%@`").find(v.front()) != std::string_view::npos) return false;
+  const std::size_t hash = v.find(" #");
+  if (hash != std::string_view::npos) v = v.substr(0, hash);
+  while (!v.empty() && v.back() == ' ') v.remove_suffix(1);
+  if (v.empty() || v == "~" || v == "null" || v == "Null" || v == "NULL") return false;
+  out.assign(v.data(), v.size());
+  return true;
+}
+
+bool intValue(std::string_view v, int& out) {
+  std::string s;
+  if (!scalarValue(v, s)) return false;
+  const auto r = std::from_chars(s.data(), s.data() + s.size(), out);
+  return r.ec == std::errc() && r.ptr == s.data() + s.size();
+}
+
+bool boolValue(std::string_view v, bool& out) {
+  std::string s;
+  if (!scalarValue(v, s)) return false;
+  if (s == "true" || s == "True" || s == "TRUE") out = true;
+  else if (s == "false" || s == "False" || s == "FALSE") out = false;
+  else return false;
+  return true;
+}
+
+// "key: value" 한 줄 처리 (key_pos = 키의 텍스트 위치)
+bool scanKeyLine(std::string_view content, std::size_t key_pos, std::size_t line_end,
+                 Frame& f, HeaderScan& h, bool& in_dxl) {
+  if (content.empty() || std::string_view("-[{'\"?&*!|>").find(content.front()) != std::string_view::npos) {
+    return false;
+  }
+  const std::size_t colon = content.find(':');
+  if (colon == std::string_view::npos || (colon + 1 < content.size() && content[colon + 1] != ' ')) return false;
+  std::string_view key = content.substr(0, colon);
+  while (!key.empty() && key.back() == ' ') key.remove_suffix(1);
+  std::string_view value = content.substr(colon + 1);
+  while (!value.empty() && value.front() == ' ') value.remove_prefix(1);
+  if (!value.empty() && value.front() == '#') value = {};
+
+  if (key == "dxl") {
+    h.has_dxl = true;
+    h.dxl_begin = key_pos;
+    h.dxl_end = line_end;
+    if (value.empty()) {
+      in_dxl = true; // 다음 줄부터 블록 시퀀스
+      return true;
+    }
+    std::string_view flow = value.substr(0, value.find(" #"));
+    while (!flow.empty() && flow.back() == ' ') flow.remove_suffix(1);
+    return flow.front() == '[' && flow.back() == ']'; // 한 줄 플로우 시퀀스
+  }
+  if (key == "time") return h.has_time = intValue(value, f.time);
+  if (key == "delay") return intValue(value, f.delay);
+  if (key == "repeat") return intValue(value, f.repeat);
+  if (key == "selected") return boolValue(value, f.selected);
+  if (key == "name") return h.has_name = scalarValue(value, f.name);
+  return !value.empty(); // 모르는 스칼라 키는 무시 (일반 로드와 동일), 중첩 값이면 yaml-cpp 로
+}
+
+// 최상위 항목 하나를 줄 단위로 훑어 프레임 헤더를 f 에 채우고 dxl 블록 범위를 기록
+HeaderScan scanItem(const std::string& text, const TextItem& item, Frame& f) {
+  constexpr std::size_t kUnknown = std::string::npos;
+  HeaderScan h;
+  std::size_t key_indent = kUnknown;
+  bool in_dxl = false;
+  bool first = true;
+
+  std::size_t eol = 0;
+  for (std::size_t pos = item.begin; pos < item.end; pos = eol + 1) {
+    const std::string_view line = lineAt(text, pos, item.end, eol);
+    std::size_t indent = 0;
+    std::string_view content;
+    if (first) {
+      // "- key: value" 또는 "-" 단독
+      first = false;
+      indent = 1;
+      while (indent < line.size() && line[indent] == ' ') ++indent;
+      content = line.substr(indent);
+      if (content.empty() || content.front() == '#') continue;
+      key_indent = indent;
+    } else {
+      indent = line.find_first_not_of(' ');
+      if (indent == std::string_view::npos) continue;
+      content = line.substr(indent);
+      if (content.front() == '#') continue;
+      if (content.front() == '\t' || indent == 0) {
+        h.ok = false;
+        return h;
+      }
+      if (key_indent == kUnknown) key_indent = indent;
+      if (in_dxl) {
+        if (indent > key_indent || (indent == key_indent && isItemStart(content))) {
+          h.dxl_end = pos + line.size();
+          continue;
+        }
+        in_dxl = false;
+      }
+      if (indent != key_indent) {
+        h.ok = false;
+        return h;
+      }
+    }
+    if (!scanKeyLine(content, pos + indent, pos + line.size(), f, h, in_dxl)) {
+      h.ok = false;
+      return h;
+    }
+  }
+  return h;
+}
+} // namespace
+
+void MotionEditor::loadLazy(std::string text) {
+  std::vector<TextItem> items;
+  {
+    MOTION_EDITOR_PROFILE_SCOPE(LoadScan);
+    if (!splitTopLevel(text, items)) items.clear();
+  }
+  if (items.empty()) {
+    // 블록 시퀀스가 아니거나 비어 있음: 일반 로드 (오류 메시지도 동일)
+    YAML::Node root;
+    {
+      MOTION_EDITOR_PROFILE_SCOPE(LoadParse);
+      root = YAML::Load(text);
+    }
+    loadFromNode(root, text.size());
+    return;
+  }
+
+  MOTION_EDITOR_PROFILE_SCOPE(LoadScan);
+  auto metas = std::make_shared<MetaList>();
+  auto store = std::make_shared<FrameStore>();
+  auto zones = std::make_shared<JointZoneMap>();
+  auto lazy = std::make_shared<LazyDxl>();
+  auto selection = std::make_shared<FrameSelection>();
+
+  std::pmr::memory_resource* mr = std::pmr::get_default_resource();
+  if (use_arena_) {
+    auto arena = std::make_shared<std::pmr::monotonic_buffer_resource>(std::max<std::size_t>(text.size() / 8, 4096));
+    mr = arena.get();
+    store->arena = std::move(arena);
+  }
+  const std::pmr::polymorphic_allocator<Frame> frame_alloc(mr);
+  std::size_t dirty_block = std::size_t(-1);
+
+  for (const auto& item : items) {
+    Frame f(mr);
+    const HeaderScan h = scanItem(text, item, f);
+
+    if (h.ok && h.has_dxl && h.has_time && h.has_name) {
+      // 헤더만 채운 프레임 + dxl 범위
+      const std::size_t i = store->count;
+      auto fp = std::allocate_shared<Frame>(frame_alloc, std::move(f));
+      zones->appendFrame(*fp);
+      selection->push_back(fp->selected);
+      if ((i >> JointZoneMap::kBlockBits) != dirty_block) {
+        dirty_block = i >> JointZoneMap::kBlockBits;
+        zones->markDirty(i); // 블록 요약은 첫 조회 때 (dxl 파싱 후) 계산
+      }
+      const Symbol name = pool_->intern(fp->name);
+      pushFrame(*store, std::move(fp), name);
+      FrameChunk& c = *store->chunks.back();
+      c.lazy.resize(c.frames.size(), kNotLazy);
+      c.lazy.back() = (std::uint32_t)lazy->ranges.size();
+      lazy->ranges.push_back(LazyDxl::Range{h.dxl_begin, h.dxl_end, !metas->motor_ids.empty()});
+      continue;
+    }
 
+    // 메타 항목, 또는 스캐너가 해석하지 못한 프레임: 이 항목만 yaml-cpp 로
+    YAML::Node root;
+    {
+      MOTION_EDITOR_PROFILE_SCOPE(LoadParse);
+      root = YAML::Load(text.substr(item.begin, item.end - item.begin));
+    }
+    if (!root.IsSequence() || root.size() != 1) {
+      throw std::runtime_error("MotionEditor: top-level must be a YAML sequence.");
+    }
+    const YAML::Node node = root[0];
+    if (hasKey(node, "dxl") && hasKey(node, "time") && hasKey(node, "name")) {
+      const std::vector<int>* order = metas->motor_ids.empty() ? nullptr : &metas->motor_ids;
+      auto fp = std::allocate_shared<Frame>(frame_alloc, parseFrameFromNode(node, mr, order));
+      zones->appendFrame(*fp);
+      selection->push_back(fp->selected);
+      const Symbol name = pool_->intern(fp->name);
+      pushFrame(*store, std::move(fp), name);
+    } else if (!parseKnownMeta(node, *metas)) {
+      metas->items.push_back(MetaBlob{MetaKind::Unknown, YAML::Clone(node)});
+    }
+  }
+
+  if (!lazy->ranges.empty()) {
+    lazy->motor_order = metas->motor_ids;
+    lazy->remaining = lazy->ranges.size();
+    lazy->parsed = std::make_unique<std::atomic<bool>[]>(lazy->ranges.size());
+    lazy->text = std::move(text);
+    store->lazy = std::move(lazy);
+  }
+
+  meta_blobs_ = std::move(metas);
+  store_ = std::move(store);
+  zones_ = std::move(zones);
+  selection_ = std::move(selection);
+}
+
+void MotionEditor::ensureLoaded(const FrameChunk& c, std::size_t k) const {
+  const std::uint32_t item = c.lazy[k];
+  if (item == kNotLazy) return;
+  LazyDxl& lz = *store_->lazy;
+  if (lz.parsed[item].load(std::memory_order_acquire)) return;
+
+  std::lock_guard<std::mutex> lk(lz.mu);
+  if (lz.parsed[item].load(std::memory_order_relaxed)) return;
+  MOTION_EDITOR_PROFILE_SCOPE(LoadDxl);
+
+  // 복제본끼리 공유하는 프레임이지만, 채우는 내용은 파일 그대로라 논리적으로 불변
+  const LazyDxl::Range& r = lz.ranges[item];
+  Frame& f = *c.frames[k];
+  const YAML::Node n = YAML::Load(lz.text.substr(r.begin, r.end - r.begin));
+  if (!n.IsMap() || !n["dxl"] || !n["dxl"].IsSequence()) {
+    throw std::runtime_error("MotionEditor: frame missing 'dxl' sequence: " + f.name);
+  }
+  parseDxlFromNode(n["dxl"], f, r.ordered && !lz.motor_order.empty() ? &lz.motor_order : nullptr);
+  markParsed(lz, item);
+}
+
+void MotionEditor::dropLazySlot(FrameChunk& c, std::size_t k) const {
+  const std::uint32_t item = c.lazy[k];
+  if (item == kNotLazy) return;
+  // 다른 복제본이 같은 프레임을 쓰고 있으면 그쪽을 위해 파싱, 아니면 파싱 없이 완료 처리
+  // (어느 쪽이든 남은 항목 수가 줄어 모두 끝나면 원문이 해제됨)
+  if (c.frames[k].use_count() > 1) {
+    ensureLoaded(c, k);
+  } else {
+    LazyDxl& lz = *store_->lazy;
+    std::lock_guard<std::mutex> lk(lz.mu);
+    markParsed(lz, item);
+  }
+  c.lazy[k] = kNotLazy;
+}
+
+void MotionEditor::markParsed(LazyDxl& lz, std::uint32_t item) {
+  if (lz.parsed[item].load(std::memory_order_relaxed)) return;
+  lz.parsed[item].store(true, std::memory_order_release);
+  if (--lz.remaining == 0) {
+    lz.text.clear();
+    lz.text.shrink_to_fit();
+  }
+}
+
+std::size_t MotionEditor::pendingFrameCount() const {
+  if (!store_->lazy) return 0;
+  std::size_t n = 0;
+  for (const auto& chunk : store_->chunks) {
+    for (std::uint32_t item : chunk->lazy) {
+      if (item != kNotLazy && !store_->lazy->parsed[item].load(std::memory_order_acquire)) ++n;
+    }
+  }
+  return n;
+}
+
+void MotionEditor::loadPendingFrames() const {
+  if (!store_->lazy) return;
+  for (const auto& chunk : store_->chunks) {
+    for (std::size_t k = 0; k < chunk->lazy.size(); ++k) ensureLoaded(*chunk, k);
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
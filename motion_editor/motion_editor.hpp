@@ -9,21 +9,34 @@
  * - Load/save motion sequences from YAML
  * - List and retrieve frames by name
  * - Edit joint positions by joint name or ID
- * - Preserve unknown metadata (MetaBlob)
+ * - Typed meta items (motion name, motor id list, type), unknown ones kept as nodes
+ * - Per-joint block min/max summaries for range queries and cached joint stats
+ * - Optional lazy loading: frame headers are indexed up front, dxl blocks are
+ *   parsed the first time a frame is touched
+ * - Frame selection bitset with one-pass bulk edits on the selected frames
  */
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
+#include <memory>
+#include <memory_resource>
 #include <unordered_map>
+#include <utility>
 #include <optional>
 #include <stdexcept>
 #include <yaml-cpp/yaml.h>
+#include <string_view>
 #include <sstream>
 #include <iostream>
 #include <fstream>
 
+#include "motion_editor/frame_selection.hpp"
+#include "motion_editor/robot_description.hpp"
+#include "motion_editor/string_pool.hpp"
+
 namespace ROBIT_HUMANOID_MOTION_EDITOR
 {
 struct DxlValue {
@@ -32,18 +45,46 @@ struct DxlValue {
 };
 
 struct Frame {
+  Frame() = default;
+  // dxl 을 지정 메모리 리소스(로드 아레나 등)에서 할당
+  explicit Frame(std::pmr::memory_resource* mr) : dxl(mr) {}
+
   // Frame fields that appear in YAML
   int time{0};
   int delay{0};
   int repeat{0};
-  std::string name;
+  std::string name;          // 짧은 이름("0", "1", ...)은 SSO 로 힙 할당 없음
   bool selected{false};
-  std::vector<DxlValue> dxl; // id-position pairs
+  std::pmr::vector<DxlValue> dxl; // id-position pairs (복사본은 기본 리소스 사용)
 };
 
 // 편집 시 어떤 관절 이름을 얼마로 바꿀지 전달하기 위한 타입
 using JointPosMap = std::unordered_map<std::string, double>; // joint_name -> rad
 
+// 심볼 기반 편집 항목 (문자열 해싱 없이 편집할 때)
+struct JointSymValue {
+  Symbol joint;
+  double position{}; // rad
+};
+
+// 관절 하나의 모션 전체 통계 (관절이 있는 프레임 기준, count 0 이면 나머지 값 무의미)
+struct JointStats {
+  std::size_t count{0};
+  double min{0.0};
+  double max{0.0};
+  double mean{0.0};
+  double range{0.0}; // max - min
+};
+
+// 선택 프레임 일괄 관절 편집 방식 (DxlValue::position 의 의미)
+enum class BulkJointOp {
+  Set,    // position = 값 (프레임에 없는 관절이면 추가)
+  Offset, // position += 값
+  Scale,  // position *= 값
+};
+
+class JointZoneMap;
+
 // YAML 모션 파일 편집기
 class MotionEditor {
 public:
@@ -53,19 +94,50 @@ public:
   // 외부에서 사용자 정의 매핑 입력 가능
   explicit MotionEditor(const std::unordered_map<std::string,int>& joint_to_id);
 
+  // 컴파일 타임 관절 테이블을 가진 로봇 (robot_description.hpp, 정적 수명 테이블만)
+  explicit MotionEditor(const JointTableView& robot);
+
+  // 복사 = O(1) 복제 (프레임/메타는 공유, 편집 시점에 건드린 프레임만 복사)
+  MotionEditor(const MotionEditor&) = default;
+  MotionEditor& operator=(const MotionEditor&) = default;
+
   // 파일 로드 (기존 데이터 모두 교체)
   void loadFromFile(const std::string& path);
 
+  // 메모리상의 YAML 텍스트에서 로드 (핫 리로드 등 파일 내용을 이미 읽은 경우)
+  void loadFromString(const std::string& yaml_text);
+
   // 파일 저장 (메타/프레임 순서는 로드된 구조를 최대한 유지)
   void saveToFile(const std::string& path) const;
 
+  // 아레나 할당 모드: 로드 시 모션 하나당 monotonic 아레나 하나에 프레임/dxl 을 배치
+  // (로드 = 큰 블록 몇 개, 해제 = 아레나 통째로 1회). 다음 loadFromFile 부터 적용.
+  // 주의: 편집기 소유 프레임의 dxl 을 std::move 로 빼내 편집기보다 오래 쓰지 말 것 (복사는 안전)
+  void setArenaAllocation(bool enable) { use_arena_ = enable; }
+  bool arenaAllocation() const { return use_arena_; }
+
+  // 지연 로드 모드: 로드 시 파일을 한 번 훑어 프레임 헤더(time/delay/repeat/name/selected)와
+  // dxl 블록의 바이트 범위만 기록하고, dxl 은 그 프레임에 처음 접근할 때
+  // (frameAt/getFrame/edit*/저장 등) 파싱. 다음 로드부터 적용.
+  // 주의: 지연 프레임의 dxl 형식 오류는 로드가 아니라 처음 접근할 때 예외
+  void setLazyLoading(bool enable) { lazy_ = enable; }
+  bool lazyLoading() const { return lazy_; }
+  // 아직 dxl 을 파싱하지 않은 프레임 수
+  std::size_t pendingFrameCount() const;
+  // 남은 프레임 전부 파싱 (여러 스레드가 읽기 전에 미리 불러 두면 이후 접근에 잠금 없음)
+  void loadPendingFrames() const;
+
   // 모든 프레임 이름 목록
   std::vector<std::string> listStepNames() const;
 
+  // 복사 없는 이름 목록 (문자열 풀이 살아 있는 동안 유효)
+  std::vector<std::string_view> listStepNameViews() const;
+
   // 이름으로 프레임 찾기 (없으면 std::nullopt)
   std::optional<Frame> getFrame(const std::string& step_name) const;
 
   // 이름으로 프레임을 찾아 4개 관절만 업데이트 (없으면 예외 throw)
+  // (레거시: 임의 그룹/범위 편집은 joint_groups.hpp 의 JointGroupEditor 사용)
   void editFourArmJoints(const std::string& step_name,
                          const JointPosMap& joint_positions_rad);
 
@@ -75,36 +147,224 @@ public:
                   const JointPosMap& joint_positions_rad,
                   bool strict = false);
 
+  // 관절 ID로 직접 편집 (컴파일 타임에 해석한 ID 사용 시 이름 조회 비용 없음)
+  //   constexpr int kR0 = robit::kRobot.id("rotate_0");
+  //   me.editJointIds("3", {{kR0, 0.1}});
+  void editJointIds(const std::string& step_name, const std::vector<DxlValue>& values);
+  // 프레임 인덱스로 지정 (이름이 중복되거나 범위 단위로 편집하는 가공 모듈용)
+  void editJointIdsAt(std::size_t i, const std::vector<DxlValue>& values);
+
+  // 관절명 -> 모터ID (없으면 -1)
+  // 컴파일 타임 테이블이 있으면 완전 해시, 사용자 정의 매핑이면 런타임 맵으로 조회
+  int jointId(std::string_view joint_name) const;
+  const JointTableView& robot() const { return robot_; }
+
   // 매핑 접근 (읽기)
   const std::unordered_map<std::string,int>& jointToId() const { return joint_to_id_; }
 
   // 매핑 수정 (주의: 이미 로드된 프레임에는 영향 없음, 편집 시에만 적용)
-  void setJointToId(const std::unordered_map<std::string,int>& m) { joint_to_id_ = m; }
+  // 사용자 정의 매핑으로 바뀌므로 컴파일 타임 테이블 조회는 해제됨
+  void setJointToId(const std::unordered_map<std::string,int>& m);
+
+  // ===== 문자열 인터닝 (프레임/관절 이름 -> 32비트 심볼) =====
+  // 모션 라이브러리 전체가 하나의 풀을 공유하도록 교체 가능 (기존 이름은 새 풀로 재등록)
+  void setStringPool(std::shared_ptr<StringPool> pool);
+  const std::shared_ptr<StringPool>& stringPool() const { return pool_; }
+  Symbol intern(std::string_view s) const { return pool_->intern(s); }
+
+  // 심볼 기반 조회/편집: 정수 비교만으로 프레임·관절을 찾음
+  Symbol frameNameSymbol(std::size_t i) const {
+    return store_->chunks[i >> kChunkBits]->names[i & kChunkMask];
+  }
+  int findFrameIndex(Symbol step) const;
+  void editJoints(Symbol step, const std::vector<JointSymValue>& joint_positions_rad,
+                  bool strict = false);
+
+  // 프레임 이름 변경 (심볼 갱신 포함, mutableFrameAt 으로 name 을 직접 바꾸지 말 것)
+  void renameFrame(std::size_t i, const std::string& name);
+
+  // 인덱스 기반 프레임 접근 (리타이밍 등 모션 전체를 훑는 가공 모듈용)
+  std::size_t frameCount() const { return store_->count; }
+  const Frame& frameAt(std::size_t i) const {
+    const FrameChunk& c = *store_->chunks[i >> kChunkBits];
+    if (!c.lazy.empty()) ensureLoaded(c, i & kChunkMask);
+    return *c.frames[i & kChunkMask];
+  }
+  // 헤더만 필요할 때 (이름/시간 목록, 스케줄링): 지연 프레임을 파싱하지 않음 (dxl 이 비어 있을 수 있음)
+  const Frame& frameHeaderAt(std::size_t i) const {
+    return *store_->chunks[i >> kChunkBits]->frames[i & kChunkMask];
+  }
+  // 쓰기 접근: 공유 중인 저장소/청크/프레임을 이 시점에 복사 (copy-on-write)
+  // 관절 값 요약은 해당 블록을 다음 조회 때 재계산 (값만 바꿀 거면 editJoints 계열이 더 쌈)
+  Frame& mutableFrameAt(std::size_t i);
+
+  // 시간/지연만 변경 (값이 있는 쪽만, 이미 같으면 프레임을 복사하지 않음), 반환: 바뀌었는지
+  // 관절 값 요약을 건드리지 않으므로 리타이밍 등에는 mutableFrameAt 대신 이것을 사용
+  bool setFrameTiming(std::size_t i, std::optional<int> time, std::optional<int> delay = std::nullopt);
+
+  // 프레임을 끝에 추가 (전환 프레임 생성 등)
+  void appendFrame(Frame f);
+
+  // i번 프레임을 통째로 교체 (부분 재파싱 결과 반영용, 이름 심볼 갱신 포함)
+  void replaceFrame(std::size_t i, Frame f);
+
+  // 프레임 항목 하나의 YAML 텍스트를 파싱 ("- time: ..." 형태 또는 맵)
+  // motor_order 가 있으면 로드와 동일하게 dxl 을 그 순서로 배치
+  static Frame parseFrame(const std::string& yaml_text,
+                          const std::vector<int>* motor_order = nullptr);
+
+  // 프레임만 비움 (메타 항목은 유지)
+  void clearFrames();
+
+  // 두 편집기가 i번 프레임 객체를 공유 중인지 (변형체 메모리 확인용)
+  bool sharesFrameWith(const MotionEditor& other, std::size_t i) const {
+    return &frameAt(i) == &other.frameAt(i);
+  }
+
+  // 관절 값 통계/범위 조회 (64프레임 블록별 min/max 요약 사용, 조건에 안 맞는 블록은 건너뜀)
+  //   통계는 관절별로 캐시되어 편집 전까지 O(1), 모르는 관절명/ID 는 count 0 / 빈 결과
+  JointStats jointStats(int motor_id) const;
+  JointStats jointStats(std::string_view joint_name) const;
+  // lo <= position <= hi 인 프레임 인덱스 (한쪽만 제한하려면 +-infinity)
+  std::vector<std::size_t> findFramesInRange(int motor_id, double lo, double hi) const;
+  std::vector<std::size_t> findFramesInRange(std::string_view joint_name, double lo, double hi) const;
+
+  // ===== 프레임 선택 =====
+  // 선택 상태는 프레임 인덱스 비트셋이 기준 (로드/추가/교체 시 Frame::selected 로 초기화,
+  // 저장 시 Frame::selected 로 기록). 선택을 바꿔도 프레임 자체는 복사되지 않으므로
+  // frameAt(i).selected 는 로드 당시 값일 수 있음 -> isSelected(i) 사용
+  const FrameSelection& selection() const { return *selection_; }
+  bool isSelected(std::size_t i) const { return selection_->test(i); }
+  std::size_t selectedCount() const { return selection_->count(); }
+  // 크기가 frameCount() 와 다르면 예외
+  void setSelection(FrameSelection sel);
+  void select(std::size_t i, bool on = true);
+  void selectRange(std::size_t first, std::size_t last, bool on = true); // [first, last)
+  void selectAll();
+  void clearSelection();
+  void invertSelection();
+
+  // 조건에 맞는 프레임 집합 (선택 조합용: me.setSelection(me.selection() | me.framesWhere(p)))
+  // 지연 로드 모션이면 방문한 프레임의 dxl 이 파싱됨
+  template <class Pred>
+  FrameSelection framesWhere(Pred&& pred) const {
+    FrameSelection out(frameCount());
+    for (std::size_t i = 0; i < frameCount(); ++i) {
+      if (pred(frameAt(i))) out.set(i);
+    }
+    return out;
+  }
+  template <class Pred>
+  void selectWhere(Pred&& pred) { setSelection(framesWhere(std::forward<Pred>(pred))); }
+
+  // 선택된 프레임 전체에 한 번에 적용 (선택 비트만 훑음), 반환: 바뀐 프레임 수
+  //   Offset/Scale 은 프레임에 없는 관절을 건너뜀
+  std::size_t editSelectedJoints(BulkJointOp op, const std::vector<DxlValue>& values);
+  std::size_t editSelectedJoints(BulkJointOp op, const JointPosMap& values, bool strict = false);
+  // 값이 있는 쪽만 설정
+  std::size_t setSelectedTiming(std::optional<int> time, std::optional<int> delay);
+
+  // 선택 비트를 Frame::selected 에 반영 (frameAt 으로 읽는 내보내기 모듈에 넘기기 전,
+  // 값이 다른 프레임만 복사)
+  void applySelectionToFrames();
+
+  // 메타 항목 (로드 시 타입 파싱, 없으면 빈 값)
+  const std::string& motionName() const { return meta_blobs_->motion_name; }
+  const std::string& motionType() const { return meta_blobs_->type; }
+  const std::vector<int>& motorIds() const { return meta_blobs_->motor_ids; }
+
+  // 메타 수정 (항목이 없던 파일이면 메타 끝에 추가)
+  void setMotionName(const std::string& name);
+  void setMotionType(const std::string& type);
+  void setMotorIds(const std::vector<int>& ids);
+
+  // 메타 항목 + 외부 프레임열로 YAML을 구성할 때 사용 (MotionSequence 등 복사 없는 저장용)
+  void appendMetaNodes(YAML::Node& seq) const;
+  static YAML::Node frameToNode(const Frame& f);
 
 private:
-  // 그중 dxl이 없는 항목(메타)은 meta_blobs_에 원형 저장,
-  // dxl이 있는 항목(프레임)은 frames_로 파싱하여 유지.
+  // 그중 dxl이 없는 항목(메타)은 meta_blobs_에 저장,
+  // dxl이 있는 항목(프레임)은 store_로 파싱하여 유지.
+  // 알려진 메타(name / motor id / type)는 타입 필드로 파싱하고 저장 시 필드로부터 노드 생성,
+  // 그 외 항목은 로드한 노드를 복제해 보관 (저장 시 재파싱 없음)
+  enum class MetaKind { MotionName, MotorIds, Type, Unknown };
   struct MetaBlob {
-    // 로드를 그대로 보존하기 위해 YAML 스칼라/시퀀스/맵핑을 문자열로 round-trip 저장
-    // (간편 구현: YAML 노드를 덤프한 문자열)
-    std::string rawYaml;
+    MetaKind kind{MetaKind::Unknown};
+    YAML::Node node; // Unknown 일 때만 사용
+  };
+  struct MetaList {
+    std::vector<MetaBlob> items; // 파일 내 순서 유지
+    std::string motion_name;
+    std::string type;
+    std::vector<int> motor_ids;
   };
 
-  std::vector<MetaBlob> meta_blobs_;
-  std::vector<Frame> frames_;
+  // 프레임 저장소: 참조 카운트 + copy-on-write
+  // store -> chunk(최대 kChunkSize개 프레임 포인터) -> Frame 3단으로 공유하므로
+  // 복제는 O(1), 편집 시에는 저장소 헤더/해당 청크/해당 프레임만 복사된다.
+  // (변형체 메모리 = 편집 수에 비례, 변형체 간 동시 편집은 외부 동기화 필요)
+  static constexpr std::size_t kChunkBits = 8;
+  static constexpr std::size_t kChunkSize = std::size_t(1) << kChunkBits;
+  static constexpr std::size_t kChunkMask = kChunkSize - 1;
+
+  // 지연 로드 원문 + 프레임별 dxl 블록 범위 (motion_editor.cpp)
+  struct LazyDxl;
+  static constexpr std::uint32_t kNotLazy = UINT32_MAX;
+
+  struct FrameChunk {
+    std::vector<std::shared_ptr<Frame>> frames;
+    std::vector<Symbol> names; // frames[k]->name 의 심볼
+    std::vector<std::uint32_t> lazy; // 지연 로드 청크만: 슬롯 -> LazyDxl 항목 (kNotLazy = 일반 프레임)
+  };
+  struct FrameStore {
+    std::shared_ptr<std::pmr::memory_resource> arena; // 아레나 모드 로드분의 수명 유지
+    std::shared_ptr<LazyDxl> lazy;                    // 지연 로드분 (복제본끼리 공유)
+    std::vector<std::shared_ptr<FrameChunk>> chunks;
+    std::size_t count{0};
+  };
+
+  std::shared_ptr<MetaList> meta_blobs_ = std::make_shared<MetaList>(); // 복제본끼리 공유, 수정 시 mutableMeta
+  std::shared_ptr<FrameStore> store_ = std::make_shared<FrameStore>();
+  std::shared_ptr<JointZoneMap> zones_; // store_ 와 같은 방식으로 복제본끼리 공유
+  std::shared_ptr<FrameSelection> selection_ = std::make_shared<FrameSelection>(); // 위와 동일
 
   std::unordered_map<std::string,int> joint_to_id_;
+  JointTableView robot_{}; // 비어 있으면 사용자 정의 매핑
+  bool use_arena_{false};
+  bool lazy_{false};
+
+  std::shared_ptr<StringPool> pool_ = std::make_shared<StringPool>();
+  std::vector<int> joint_sym_to_id_; // 관절명 심볼 id -> 모터ID (-1 = 미등록)
 
   // 내부 유틸
   static bool approxEqual(double a, double b, double eps=1e-12);
   int findFrameIndexByName(const std::string& step_name) const;
 
   // YAML <-> 내부 변환
-  static Frame parseFrame(const std::string& rawDump);
-  static Frame parseFrameFromNode(const struct YAML::Node& node);
-  static std::string dumpMetaNode(const struct YAML::Node& node);
-  static struct YAML::Node buildYamlFromAll(const std::vector<MetaBlob>& metas,
-                                            const std::vector<Frame>& frames);
+  void loadFromNode(const YAML::Node& root, std::size_t size_hint);
+  void loadLazy(std::string text);
+  void ensureLoaded(const FrameChunk& c, std::size_t k) const;
+  // 지연 항목 완료 처리 (lz.mu 잡은 상태에서 호출), 모두 끝나면 원문 해제
+  static void markParsed(LazyDxl& lz, std::uint32_t item);
+  // 통째로 교체될 지연 슬롯을 일반 슬롯으로 전환 (파싱 안 된 항목도 완료 처리)
+  void dropLazySlot(FrameChunk& c, std::size_t k) const;
+  static void parseDxlFromNode(const YAML::Node& dxl, Frame& f, const std::vector<int>* motor_order);
+  static Frame parseFrameFromNode(const struct YAML::Node& node,
+                                  std::pmr::memory_resource* mr = std::pmr::get_default_resource(),
+                                  const std::vector<int>* motor_order = nullptr);
+  static bool parseKnownMeta(const YAML::Node& item, MetaList& metas);
+  MetaList& mutableMeta();
+  static void appendMetaNodes(const MetaList& metas, YAML::Node& seq);
+  static struct YAML::Node buildYamlFromAll(const MetaList& metas,
+                                            const FrameStore& frames,
+                                            const FrameSelection& selection);
+  static void pushFrame(FrameStore& store, std::shared_ptr<Frame> f, Symbol name);
+  void setDxlPosition(std::size_t i, Frame& f, int id, double position);
+  void rebuildJointSymbols();
+  FrameStore& detachStore();
+  Frame& detachFrame(std::size_t i); // 구역 요약을 건드리지 않는 쓰기 접근
+  JointZoneMap& mutableZones();
+  FrameSelection& mutableSelection();
 public:
   static void printFrame(const Frame& f)
   {
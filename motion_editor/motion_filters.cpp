@@ -0,0 +1,257 @@
+/*
+ * Motion Filters
+ * @file motion_filters.cpp
+ * Column smoothing kernels and range application.
+ *
+ * Every kernel first copies the samples it needs (range + context, extended past
+ * the column ends) into one contiguous scratch buffer, so the inner loops are
+ * branch-free stride-1 loops.
+ */
+
+#include "motion_editor/motion_filters.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+void checkHalfWindow(int half_window) {
+  if (half_window < 0) throw std::runtime_error("MotionSmoother: half_window must be >= 0");
+}
+
+void checkCutoff(double cutoff) {
+  if (!(cutoff > 0.0 && cutoff < 0.5)) throw std::runtime_error("MotionSmoother: cutoff must be in (0, 0.5)");
+}
+
+// xp[t] = in[clamp(first + t, 0, n - 1)], t in [0, len)
+void fillClamped(const double* in, std::size_t n, long first, std::size_t len, double* xp) {
+  const long last = (long)n - 1;
+  for (std::size_t t = 0; t < len; ++t) xp[t] = in[std::clamp(first + (long)t, 0L, last)];
+}
+
+void movingAverageRange(const double* in, std::size_t n, std::size_t begin, std::size_t end,
+                        int m, double* out, std::vector<double>& scratch) {
+  const std::size_t len = end - begin, w = 2 * (std::size_t)m + 1;
+  scratch.resize(len + w - 1);
+  double* xp = scratch.data();
+  fillClamped(in, n, (long)begin - m, scratch.size(), xp);
+
+  // 누적 합 대신 창 이동 합 (큰 값에서 상쇄 오차가 쌓이지 않도록 주기적으로 다시 합산)
+  const double inv = 1.0 / (double)w;
+  double sum = 0.0;
+  for (std::size_t k = 0; k < w; ++k) sum += xp[k];
+  for (std::size_t l = 0; l < len; ++l) {
+    if (l != 0) {
+      if ((l & 1023) == 0) {
+        sum = 0.0;
+        for (std::size_t k = 0; k < w; ++k) sum += xp[l + k];
+      } else {
+        sum += xp[l + w - 1] - xp[l - 1];
+      }
+    }
+    out[l] = sum * inv;
+  }
+}
+
+void convolveRange(const double* in, std::size_t n, std::size_t begin, std::size_t end,
+                   const std::vector<double>& c, double* out, std::vector<double>& scratch) {
+  const std::size_t len = end - begin, w = c.size(), m = w / 2;
+  scratch.resize(len + w - 1);
+  double* xp = scratch.data();
+  fillClamped(in, n, (long)begin - (long)m, scratch.size(), xp);
+
+  // 계수 바깥, 프레임 안쪽 루프 (stride-1 axpy)
+  std::fill(out, out + len, 0.0);
+  for (std::size_t k = 0; k < w; ++k) {
+    const double ck = c[k];
+    const double* x = xp + k;
+    for (std::size_t l = 0; l < len; ++l) out[l] += ck * x[l];
+  }
+}
+
+// 2차 버터워스 저역통과 (쌍선형 변환), 직접형 II 전치
+struct Biquad {
+  double b0, b1, b2, a1, a2;
+
+  explicit Biquad(double cutoff) {
+    const double K = std::tan(M_PI * cutoff);
+    const double norm = 1.0 / (1.0 + std::sqrt(2.0) * K + K * K);
+    b0 = K * K * norm;
+    b1 = 2.0 * b0;
+    b2 = b0;
+    a1 = 2.0 * (K * K - 1.0) * norm;
+    a2 = (1.0 - std::sqrt(2.0) * K + K * K) * norm;
+  }
+
+  // 첫 입력이 계속됐던 것처럼 상태를 정상 상태로 두고 x 를 제자리 필터링 (step 방향)
+  void run(double* x, std::size_t len, long step) const {
+    double* p = step > 0 ? x : x + len - 1;
+    const double x0 = *p;
+    double z1 = (1.0 - b0) * x0, z2 = (b2 - a2) * x0;
+    for (std::size_t l = 0; l < len; ++l, p += step) {
+      const double xi = *p;
+      const double y = b0 * xi + z1;
+      z1 = b1 * xi - a1 * y + z2;
+      z2 = b2 * xi - a2 * y;
+      *p = y;
+    }
+  }
+};
+
+void lowPassRange(const double* in, std::size_t n, std::size_t begin, std::size_t end,
+                  double cutoff, double* out, std::vector<double>& scratch) {
+  // 과도 응답이 사라질 만큼 앞뒤 문맥 사용 (열 끝에서는 홀수 반사로 연장)
+  const std::size_t ctx = (std::size_t)std::ceil(4.0 / cutoff);
+  const std::size_t lo = begin - std::min(begin, ctx);
+  const std::size_t hi = std::min(n, end + ctx);
+  const std::size_t L = hi - lo;
+  if (L < 2) {
+    if (out != in + begin) std::copy(in + begin, in + end, out);
+    return;
+  }
+  const std::size_t pad = std::min(ctx, L - 1);
+
+  scratch.resize(L + 2 * pad);
+  double* buf = scratch.data();
+  for (std::size_t t = 0; t < pad; ++t) {
+    buf[t] = 2.0 * in[lo] - in[lo + pad - t];
+    buf[pad + L + t] = 2.0 * in[hi - 1] - in[hi - 2 - t];
+  }
+  std::copy(in + lo, in + hi, buf + pad);
+
+  const Biquad bq(cutoff);
+  bq.run(buf, scratch.size(), +1);
+  bq.run(buf, scratch.size(), -1);
+  std::copy(buf + pad + (begin - lo), buf + pad + (end - lo), out);
+}
+} // namespace
+
+// ===== 열 단위 커널 =====
+
+std::vector<double> savitzkyGolayCoefficients(int half_window, int poly_order) {
+  checkHalfWindow(half_window);
+  const int w = 2 * half_window + 1;
+  if (poly_order < 0 || poly_order >= w) {
+    throw std::runtime_error("MotionSmoother: poly_order must be in [0, " + std::to_string(w - 1) + "]");
+  }
+
+  // 정규방정식 (A^T A) a = A^T e_j 의 0차 계수 = 중앙 적합값에 대한 j 의 가중치
+  //   A[j][i] = j^i, j in [-m, m]  ->  c_j = sum_i (A^T A)^-1[0][i] * j^i
+  const int P = poly_order + 1;
+  std::vector<double> G(P * P, 0.0), rhs(P, 0.0);
+  for (int j = -half_window; j <= half_window; ++j) {
+    for (int r = 0; r < P; ++r) {
+      for (int c = 0; c < P; ++c) G[r * P + c] += std::pow((double)j, r + c);
+    }
+  }
+  // (A^T A)^-1 의 0번 행 = G x = e_0 의 해 (G 대칭)
+  rhs[0] = 1.0;
+  for (int col = 0; col < P; ++col) {
+    int piv = col;
+    for (int r = col + 1; r < P; ++r) {
+      if (std::abs(G[r * P + col]) > std::abs(G[piv * P + col])) piv = r;
+    }
+    if (piv != col) {
+      for (int c = 0; c < P; ++c) std::swap(G[col * P + c], G[piv * P + c]);
+      std::swap(rhs[col], rhs[piv]);
+    }
+    for (int r = 0; r < P; ++r) {
+      if (r == col) continue;
+      const double f = G[r * P + col] / G[col * P + col];
+      for (int c = col; c < P; ++c) G[r * P + c] -= f * G[col * P + c];
+      rhs[r] -= f * rhs[col];
+    }
+  }
+  for (int r = 0; r < P; ++r) rhs[r] /= G[r * P + r];
+
+  std::vector<double> coeffs(w, 0.0);
+  for (int j = -half_window; j <= half_window; ++j) {
+    double v = 0.0;
+    for (int i = 0; i < P; ++i) v += rhs[i] * std::pow((double)j, i);
+    coeffs[j + half_window] = v;
+  }
+  return coeffs;
+}
+
+void movingAverage(const double* in, double* out, std::size_t n, int half_window) {
+  checkHalfWindow(half_window);
+  std::vector<double> scratch;
+  if (n) movingAverageRange(in, n, 0, n, half_window, out, scratch);
+}
+
+void savitzkyGolay(const double* in, double* out, std::size_t n, int half_window, int poly_order) {
+  const auto c = savitzkyGolayCoefficients(half_window, poly_order);
+  std::vector<double> scratch;
+  if (n) convolveRange(in, n, 0, n, c, out, scratch);
+}
+
+void zeroPhaseLowPass(const double* in, double* out, std::size_t n, double cutoff) {
+  checkCutoff(cutoff);
+  std::vector<double> scratch;
+  if (n) lowPassRange(in, n, 0, n, cutoff, out, scratch);
+}
+
+// ===== MotionSmoother =====
+
+MotionSmoother::MotionSmoother(const SmoothingOptions& opt)
+: opt_(opt) {
+  switch (opt_.kind) {
+    case SmoothingKind::MovingAverage: checkHalfWindow(opt_.half_window); break;
+    case SmoothingKind::SavitzkyGolay: sg_coeffs_ = savitzkyGolayCoefficients(opt_.half_window, opt_.poly_order); break;
+    case SmoothingKind::ZeroPhaseLowPass: checkCutoff(opt_.cutoff); break;
+  }
+}
+
+void MotionSmoother::filterColumn(const double* in, std::size_t n, std::size_t begin, std::size_t end,
+                                  double* out, std::vector<double>& scratch) const {
+  switch (opt_.kind) {
+    case SmoothingKind::MovingAverage:
+      movingAverageRange(in, n, begin, end, opt_.half_window, out + begin, scratch);
+      break;
+    case SmoothingKind::SavitzkyGolay:
+      convolveRange(in, n, begin, end, sg_coeffs_, out + begin, scratch);
+      break;
+    case SmoothingKind::ZeroPhaseLowPass:
+      lowPassRange(in, n, begin, end, opt_.cutoff, out + begin, scratch);
+      break;
+  }
+}
+
+void MotionSmoother::apply(const JointColumns& src, JointColumns& dst, std::size_t begin, std::size_t end) const {
+  if (&src == &dst) {
+    apply(dst, begin, end);
+    return;
+  }
+  if (dst.frames() != src.frames() || dst.ids() != src.ids()) {
+    throw std::runtime_error("MotionSmoother: dst must have the same layout as src");
+  }
+  if (begin > end || end > src.frames()) throw std::runtime_error("MotionSmoother: frame range out of bounds");
+  if (begin == end) return;
+
+  std::vector<double> scratch;
+  for (std::size_t k = 0; k < src.joints(); ++k) {
+    filterColumn(src.column(k), src.frames(), begin, end, dst.column(k), scratch);
+  }
+}
+
+void MotionSmoother::apply(JointColumns& cols, std::size_t begin, std::size_t end) const {
+  if (begin > end || end > cols.frames()) throw std::runtime_error("MotionSmoother: frame range out of bounds");
+  if (begin == end) return;
+
+  // 커널이 필요한 입력을 모두 스크래치로 복사한 뒤 기록하므로 같은 열에 바로 써도 됨
+  std::vector<double> scratch;
+  for (std::size_t k = 0; k < cols.joints(); ++k) {
+    filterColumn(cols.column(k), cols.frames(), begin, end, cols.column(k), scratch);
+  }
+}
+
+void MotionSmoother::apply(MotionEditor& me, const std::vector<int>& ids, std::size_t begin, std::size_t end) const {
+  if (begin > end || end > me.frameCount()) throw std::runtime_error("MotionSmoother: frame range out of bounds");
+  JointColumns cols = ids.empty() ? JointColumns::extractAll(me) : JointColumns::extract(me, ids);
+  apply(cols, begin, end);
+  cols.writeBack(me, begin, end);
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,70 @@
+/*
+ * Motion Filters
+ * @file motion_filters.hpp
+ * Smoothing of joint trajectories along the time axis (frame index = sample),
+ * for jittery teach-recorded motions.
+ *
+ * Key features:
+ * - Moving average, Savitzky-Golay and zero-phase (forward-backward) Butterworth low-pass
+ * - Kernels run on JointColumns (one stride-1 column per joint)
+ * - A [begin, end) range is filtered with the surrounding frames as context,
+ *   only the range itself is written
+ * - src -> dst form keeps the original columns for live preview (no re-extract per update)
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "motion_editor/joint_columns.hpp"
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+enum class SmoothingKind {
+  MovingAverage,   // 2*half_window+1 프레임 평균
+  SavitzkyGolay,   // 창 안 poly_order 차 다항식 최소자승 적합값 (피크 보존)
+  ZeroPhaseLowPass // 2차 버터워스 정방향+역방향 (위상 지연 없음)
+};
+
+struct SmoothingOptions {
+  SmoothingKind kind{SmoothingKind::MovingAverage};
+  int half_window{2};  // MovingAverage / SavitzkyGolay
+  int poly_order{2};   // SavitzkyGolay (< 2*half_window+1)
+  double cutoff{0.1};  // ZeroPhaseLowPass: 차단 주파수 [cycles/frame], 0 < cutoff < 0.5
+};
+
+// 열 단위 커널: out[l] = filter(in)[l], l in [0, n) (in == out 이면 제자리)
+// 양 끝은 가장자리 값 반복(MA/SG) 또는 홀수 반사(low-pass)로 연장
+void movingAverage(const double* in, double* out, std::size_t n, int half_window);
+void savitzkyGolay(const double* in, double* out, std::size_t n, int half_window, int poly_order);
+void zeroPhaseLowPass(const double* in, double* out, std::size_t n, double cutoff);
+
+// Savitzky-Golay 평활 계수 (길이 2*half_window+1, 중앙 = half_window)
+std::vector<double> savitzkyGolayCoefficients(int half_window, int poly_order);
+
+class MotionSmoother {
+public:
+  explicit MotionSmoother(const SmoothingOptions& opt);
+
+  const SmoothingOptions& options() const { return opt_; }
+
+  // src 의 [begin, end) 를 평활해 dst 의 같은 위치에 기록 (dst 는 src 복사본, 범위 밖은 그대로)
+  //   미리보기: JointColumns preview = cols; 슬라이더가 움직일 때마다 apply(cols, preview, b, e)
+  void apply(const JointColumns& src, JointColumns& dst, std::size_t begin, std::size_t end) const;
+  // 제자리 평활
+  void apply(JointColumns& cols, std::size_t begin, std::size_t end) const;
+
+  // 편집기 직접: ids 열 추출 (비우면 모션의 모든 관절) -> 평활 -> [begin, end) 기록
+  void apply(MotionEditor& me, const std::vector<int>& ids, std::size_t begin, std::size_t end) const;
+
+private:
+  // in: 열 전체 (길이 n), [begin, end) 를 걸러 out 의 같은 위치에 기록 (앞뒤 프레임은 문맥으로만 사용)
+  void filterColumn(const double* in, std::size_t n, std::size_t begin, std::size_t end,
+                    double* out, std::vector<double>& scratch) const;
+
+  SmoothingOptions opt_;
+  std::vector<double> sg_coeffs_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,413 @@
+/*
+ * Motion Library
+ * @file motion_library.cpp
+ * A set of named motions sharing one string pool, with inotify-based hot reload.
+ *
+ * Incremental reparse:
+ * - The file text is split into top-level sequence items ("- " at column 0).
+ * - Each item's text is hashed; on reload only items whose hash changed are
+ *   reparsed, provided the item count is unchanged and every changed item is
+ *   a frame item. Otherwise the whole file is reparsed.
+ * - Unchanged frames stay shared with the previous version of the motion.
+ */
+
+#include "motion_editor/motion_library.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace fs = std::filesystem;
+
+namespace {
+struct ItemRange {
+  std::size_t begin;
+  std::size_t end;
+  bool frame; // 항목 레벨에 dxl 키가 있음
+};
+
+std::string readFile(const std::string& path) {
+  std::ifstream ifs(path, std::ios::binary);
+  if (!ifs) throw std::runtime_error("MotionLibrary: cannot open file: " + path);
+  std::string text;
+  ifs.seekg(0, std::ios::end);
+  text.resize((std::size_t)ifs.tellg());
+  ifs.seekg(0, std::ios::beg);
+  ifs.read(text.data(), (std::streamsize)text.size());
+  return text;
+}
+
+bool startsWith(std::string_view s, std::string_view p) {
+  return s.size() >= p.size() && s.compare(0, p.size(), p) == 0;
+}
+
+// 블록 스타일 최상위 시퀀스를 항목 단위로 분할 (앞쪽 주석/빈 줄은 버림)
+std::vector<ItemRange> splitItems(const std::string& text) {
+  std::vector<ItemRange> items;
+  std::size_t pos = 0;
+  while (pos < text.size()) {
+    std::size_t eol = text.find('\n', pos);
+    if (eol == std::string::npos) eol = text.size();
+    const std::string_view line(text.data() + pos, eol - pos);
+
+    if (startsWith(line, "- ") || line == "-") {
+      if (!items.empty()) items.back().end = pos;
+      items.push_back(ItemRange{pos, text.size(), false});
+    }
+    if (!items.empty() && (startsWith(line, "- dxl:") || startsWith(line, "  dxl:"))) {
+      items.back().frame = true;
+    }
+    pos = eol + 1;
+  }
+  return items;
+}
+
+// 파일 전체 / 항목별 텍스트 해시
+template <class EntryT>
+void hashText(EntryT& e, const std::string& text, const std::vector<ItemRange>& items) {
+  e.text_hash = std::hash<std::string_view>{}(text);
+  e.item_hashes.reserve(items.size());
+  for (const auto& it : items) {
+    e.item_hashes.push_back(std::hash<std::string_view>{}(
+      std::string_view(text.data() + it.begin, it.end - it.begin)));
+  }
+}
+
+// 항목 -> 프레임 인덱스. 텍스트 분할이 실제 로드 결과와 맞을 때만 다음부터 부분 재파싱 허용
+// (플로우 스타일 등은 제외)
+template <class EntryT>
+void indexFrames(EntryT& e, const std::vector<ItemRange>& items, std::size_t frame_count) {
+  e.item_frame.assign(items.size(), -1);
+  int frames = 0;
+  for (std::size_t i = 0; i < items.size(); ++i) {
+    if (items[i].frame) e.item_frame[i] = frames++;
+  }
+  e.incremental = (frames == (int)frame_count);
+}
+
+bool isMotionFile(const fs::path& p) {
+  return p.extension() == ".yaml" || p.extension() == ".yml";
+}
+
+// 항목 경로와 감시 이벤트 경로를 같은 형태로 비교하기 위한 절대 경로
+std::string normalizePath(const std::string& path) {
+  return fs::absolute(path).lexically_normal().string();
+}
+} // namespace
+
+MotionLibrary::MotionLibrary()
+: MotionLibrary(MotionEditor()) {}
+
+MotionLibrary::MotionLibrary(const MotionEditor& prototype)
+: prototype_(prototype),
+  pool_(std::make_shared<StringPool>()),
+  map_(std::make_shared<const Map>()) {
+  prototype_.clearFrames();
+  prototype_.setStringPool(pool_);
+}
+
+MotionLibrary::~MotionLibrary() {
+  stopWatching();
+}
+
+std::shared_ptr<const MotionLibrary::Map> MotionLibrary::snapshot() const {
+  return std::atomic_load(&map_);
+}
+
+void MotionLibrary::publish(const std::string& name, std::shared_ptr<const Entry> entry) {
+  // 호출자가 write_mu_ 를 잡고 있음
+  auto next = std::make_shared<Map>(*snapshot());
+  (*next)[name] = std::move(entry);
+  std::atomic_store(&map_, std::shared_ptr<const Map>(std::move(next)));
+  generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+std::shared_ptr<const MotionLibrary::Entry>
+MotionLibrary::build(const std::string& path, const std::string& text, const Entry* prev,
+                     std::size_t& reparsed) const {
+  const std::vector<ItemRange> items = splitItems(text);
+
+  auto e = std::make_shared<Entry>();
+  e->path = path;
+  hashText(*e, text, items);
+
+  // 1) 부분 재파싱: 항목 수가 같고 바뀐 항목이 모두 프레임일 때
+  if (prev && prev->incremental && items.size() == prev->item_hashes.size()) {
+    std::vector<std::size_t> changed;
+    bool ok = true;
+    for (std::size_t i = 0; i < items.size() && ok; ++i) {
+      if (e->item_hashes[i] == prev->item_hashes[i]) continue;
+      ok = items[i].frame && prev->item_frame[i] >= 0;
+      changed.push_back(i);
+    }
+    if (ok) {
+      auto next = std::make_shared<MotionEditor>(*prev->motion); // O(1) 복제
+      const std::vector<int>* order = next->motorIds().empty() ? nullptr : &next->motorIds();
+      for (std::size_t i : changed) {
+        const std::string item(text, items[i].begin, items[i].end - items[i].begin);
+        next->replaceFrame((std::size_t)prev->item_frame[i], MotionEditor::parseFrame(item, order));
+      }
+      e->motion = std::move(next);
+      e->item_frame = prev->item_frame;
+      e->incremental = true;
+      reparsed = changed.size();
+      return e;
+    }
+  }
+
+  // 2) 전체 재파싱
+  auto next = std::make_shared<MotionEditor>(prototype_);
+  next->loadFromString(text);
+
+  indexFrames(*e, items, next->frameCount());
+  e->motion = std::move(next);
+  reparsed = items.size();
+  return e;
+}
+
+std::string MotionLibrary::load(const std::string& path) {
+  const std::string abs = normalizePath(path);
+  const std::string name = fs::path(abs).stem().string();
+  std::size_t reparsed = 0;
+  const std::string text = readFile(abs);
+  {
+    std::lock_guard<std::mutex> lk(write_mu_);
+    // 이름은 파일명(stem) 이므로 다른 경로의 같은 이름 파일이 기존 모션을 덮어쓰지 않도록 거부
+    auto snap = snapshot();
+    auto it = snap->find(name);
+    if (it != snap->end() && it->second->path != abs) {
+      throw std::runtime_error("MotionLibrary: motion '" + name + "' already loaded from " + it->second->path + ": " + abs);
+    }
+    publish(name, build(abs, text, nullptr, reparsed));
+  }
+  // 감시 중에 새 디렉토리의 모션을 로드한 경우 그 디렉토리도 감시 (감시 중이 아니면 무시)
+  addWatch(fs::path(abs).parent_path().string());
+  return name;
+}
+
+std::size_t MotionLibrary::loadDirectory(const std::string& dir) {
+  if (!fs::is_directory(dir)) throw std::runtime_error("MotionLibrary: not a directory: " + dir);
+
+  std::vector<fs::path> files;
+  for (const auto& entry : fs::directory_iterator(dir)) {
+    if (entry.is_regular_file() && isMotionFile(entry.path())) files.push_back(entry.path());
+  }
+  std::sort(files.begin(), files.end());
+  for (const auto& f : files) load(f.string());
+  return files.size();
+}
+
+std::shared_ptr<const MotionEditor> MotionLibrary::get(std::string_view name) const {
+  auto snap = snapshot();
+  auto it = snap->find(std::string(name));
+  return it == snap->end() ? nullptr : it->second->motion;
+}
+
+std::vector<std::string> MotionLibrary::names() const {
+  auto snap = snapshot();
+  std::vector<std::string> out;
+  out.reserve(snap->size());
+  for (const auto& kv : *snap) out.push_back(kv.first);
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+std::size_t MotionLibrary::size() const {
+  return snapshot()->size();
+}
+
+std::size_t MotionLibrary::reload(const std::string& name) {
+  std::lock_guard<std::mutex> lk(write_mu_);
+  auto snap = snapshot();
+  auto it = snap->find(name);
+  if (it == snap->end()) throw std::runtime_error("MotionLibrary: unknown motion: " + name);
+
+  std::size_t reparsed = 0;
+  auto entry = build(it->second->path, readFile(it->second->path), it->second.get(), reparsed);
+  publish(name, std::move(entry));
+  return reparsed;
+}
+
+bool MotionLibrary::replace(const std::string& name, std::shared_ptr<const MotionEditor> motion,
+                            const std::shared_ptr<const MotionEditor>& expected) {
+  if (!motion) throw std::runtime_error("MotionLibrary: null motion: " + name);
+  std::lock_guard<std::mutex> lk(write_mu_);
+  auto snap = snapshot();
+  auto it = snap->find(name);
+  if (it == snap->end()) throw std::runtime_error("MotionLibrary: unknown motion: " + name);
+  // 사본의 기준이 이미 교체됐으면 발행하지 않음 (리로드 결과와 그 파일 해시를 덮지 않도록)
+  if (expected && it->second->motion != expected) return false;
+
+  auto e = std::make_shared<Entry>(*it->second);
+  e->motion = std::move(motion);
+  e->incremental = false; // 항목 해시가 더 이상 모션과 대응하지 않음 (파일 해시는 유지)
+  publish(name, std::move(e));
+  return true;
+}
+
+std::string MotionLibrary::save(const std::string& name) {
+  std::lock_guard<std::mutex> lk(write_mu_);
+  auto snap = snapshot();
+  auto it = snap->find(name);
+  if (it == snap->end()) throw std::runtime_error("MotionLibrary: unknown motion: " + name);
+
+  const Entry& cur = *it->second;
+  cur.motion->saveToFile(cur.path);
+
+  // 쓴 내용으로 해시를 갱신해 이 저장이 일으킨 파일 이벤트는 무시되고,
+  // 이후 외부 편집은 저장된 모션 기준으로 부분 재파싱되도록
+  const std::string text = readFile(cur.path);
+  const std::vector<ItemRange> items = splitItems(text);
+  auto e = std::make_shared<Entry>();
+  e->path = cur.path;
+  e->motion = cur.motion;
+  hashText(*e, text, items);
+  indexFrames(*e, items, cur.motion->frameCount());
+  publish(name, std::move(e));
+  return cur.path;
+}
+
+void MotionLibrary::setReloadCallback(ReloadCallback cb) {
+  std::lock_guard<std::mutex> lk(cb_mu_);
+  callback_ = std::move(cb);
+}
+
+// ===== inotify 감시 =====
+
+void MotionLibrary::startWatching(std::chrono::milliseconds debounce) {
+  if (watching()) return;
+  wake_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wake_fd_ < 0) throw std::runtime_error("MotionLibrary: eventfd failed");
+  inotify_fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ < 0) {
+    ::close(wake_fd_);
+    wake_fd_ = -1;
+    throw std::runtime_error("MotionLibrary: inotify_init1 failed");
+  }
+
+  // 현재 로드된 모션들의 디렉토리를 감시 (에디터의 "임시 파일 후 rename" 저장도 잡도록 디렉토리 단위)
+  std::set<std::string> dirs;
+  for (const auto& kv : *snapshot()) dirs.insert(fs::path(kv.second->path).parent_path().string());
+  for (const auto& d : dirs) addWatch(d);
+
+  watch_thread_ = std::thread(&MotionLibrary::watchLoop, this, debounce);
+}
+
+void MotionLibrary::stopWatching() {
+  if (!watching()) return;
+  const std::uint64_t one = 1;
+  (void)!::write(wake_fd_, &one, sizeof(one));
+  watch_thread_.join();
+  ::close(wake_fd_);
+  wake_fd_ = -1;
+  std::lock_guard<std::mutex> lk(watch_mu_);
+  ::close(inotify_fd_);
+  inotify_fd_ = -1;
+  wd_dir_.clear();
+}
+
+void MotionLibrary::addWatch(const std::string& dir) {
+  std::lock_guard<std::mutex> lk(watch_mu_);
+  if (inotify_fd_ < 0) return;
+  // 같은 디렉토리는 같은 wd 를 돌려주므로 중복 등록 없음
+  const int wd = ::inotify_add_watch(inotify_fd_, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+  if (wd >= 0) wd_dir_[wd] = dir;
+}
+
+void MotionLibrary::reloadPath(const std::string& event_path) {
+  const std::string path = normalizePath(event_path);
+  const std::string name = fs::path(path).stem().string();
+  // 라이브러리에 로드된 파일만 리로드 (감시 디렉토리의 다른 파일, 같은 이름의 다른 경로는 무시)
+  const auto loaded = [&](const Map& snap) -> const Entry* {
+    auto it = snap.find(name);
+    return (it != snap.end() && it->second->path == path) ? it->second.get() : nullptr;
+  };
+  if (!loaded(*snapshot())) return;
+
+  std::size_t reparsed = 0;
+  std::string error;
+  bool ok = true;
+  try {
+    const std::string text = readFile(path);
+    std::lock_guard<std::mutex> lk(write_mu_);
+    auto snap = snapshot();
+    const Entry* prev = loaded(*snap);
+    if (!prev) return;
+    // 마지막으로 읽거나 쓴 내용 그대로면 (자기 저장, touch 등) 발행/통지 없음
+    if (prev->text_hash == std::hash<std::string_view>{}(text)) return;
+    publish(name, build(path, text, prev, reparsed));
+  } catch (const std::exception& e) {
+    // 편집 도중 저장 등으로 깨진 파일이면 이전 버전을 유지
+    ok = false;
+    error = e.what();
+  }
+
+  std::lock_guard<std::mutex> lk(cb_mu_);
+  if (callback_) callback_(name, ok, reparsed, error);
+}
+
+void MotionLibrary::watchLoop(std::chrono::milliseconds debounce) {
+  using Clock = std::chrono::steady_clock;
+
+  const int ifd = inotify_fd_; // stopWatching 이 스레드 종료 후에 닫음
+  std::map<std::string, Clock::time_point> pending; // 경로 -> 리로드 시각 (디바운스)
+  alignas(inotify_event) char buf[16 * 1024];
+
+  for (;;) {
+    int timeout_ms = -1;
+    if (!pending.empty()) {
+      auto first = std::min_element(pending.begin(), pending.end(),
+                                    [](const auto& a, const auto& b) { return a.second < b.second; });
+      const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(first->second - Clock::now());
+      timeout_ms = (int)std::max<long long>(0, wait.count());
+    }
+
+    pollfd fds[2] = {{ifd, POLLIN, 0}, {wake_fd_, POLLIN, 0}};
+    const int r = ::poll(fds, 2, timeout_ms);
+    if (r < 0 && errno != EINTR) break;
+    if (fds[1].revents & POLLIN) break; // stopWatching
+
+    if (fds[0].revents & POLLIN) {
+      for (;;) {
+        const ssize_t len = ::read(ifd, buf, sizeof(buf));
+        if (len <= 0) break;
+        for (char* p = buf; p < buf + len;) {
+          const auto* ev = reinterpret_cast<const inotify_event*>(p);
+          p += sizeof(inotify_event) + ev->len;
+          if (ev->len == 0) continue;
+          fs::path path;
+          {
+            std::lock_guard<std::mutex> lk(watch_mu_);
+            auto d = wd_dir_.find(ev->wd);
+            if (d == wd_dir_.end()) continue;
+            path = fs::path(d->second) / ev->name;
+          }
+          if (!isMotionFile(path)) continue;
+          pending[path.string()] = Clock::now() + debounce; // 이벤트가 이어지면 뒤로 미룸
+        }
+      }
+    }
+
+    const auto now = Clock::now();
+    for (auto it = pending.begin(); it != pending.end();) {
+      if (it->second <= now) {
+        reloadPath(it->first);
+        it = pending.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
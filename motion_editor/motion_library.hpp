@@ -0,0 +1,129 @@
+/*
+ * Motion Library
+ * @file motion_library.hpp
+ * A set of named motions (file stem -> MotionEditor) sharing one string pool,
+ * with optional inotify-based hot reload.
+ *
+ * Key features:
+ * - Readers take an immutable snapshot; they never wait for a reload
+ * - Reloads build the new motion off to the side and publish it atomically
+ * - Watcher thread debounces file events and reparses only changed files
+ * - When only frame items changed, only those items are reparsed and the
+ *   rest of the motion is shared with the previous version (copy-on-write)
+ * - In-memory edits can be published (replace) and written back (save); a file
+ *   event whose content matches what was last read or written is ignored
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+class MotionLibrary {
+public:
+  // 리로드 결과 통지 (감시 스레드에서 호출됨)
+  //   name: 모션 이름, ok: 성공 여부, reparsed_items: 다시 파싱한 항목 수 (전체 로드면 전체 항목 수)
+  using ReloadCallback =
+    std::function<void(const std::string& name, bool ok, std::size_t reparsed_items, const std::string& error)>;
+
+  // prototype 의 관절 매핑/아레나 설정을 모든 모션이 물려받음
+  MotionLibrary();
+  explicit MotionLibrary(const MotionEditor& prototype);
+  ~MotionLibrary();
+
+  MotionLibrary(const MotionLibrary&) = delete;
+  MotionLibrary& operator=(const MotionLibrary&) = delete;
+
+  // 파일 하나 로드/교체 (이름 = 파일 stem, 경로는 절대 경로로 저장), 반환: 모션 이름
+  // 감시 중이면 파일의 디렉토리도 감시 대상에 추가
+  // 같은 이름이 다른 경로에서 이미 로드되어 있으면 예외
+  std::string load(const std::string& path);
+
+  // 디렉토리의 *.yaml / *.yml 전체 로드, 반환: 로드한 파일 수
+  std::size_t loadDirectory(const std::string& dir);
+
+  // 읽기: 현재 스냅샷의 모션 (없으면 nullptr), 락 대기 없음
+  std::shared_ptr<const MotionEditor> get(std::string_view name) const;
+  std::vector<std::string> names() const;
+  std::size_t size() const;
+
+  // 발행할 때마다 증가 (변경 감지용)
+  std::uint64_t generation() const { return generation_.load(std::memory_order_acquire); }
+
+  const std::shared_ptr<StringPool>& stringPool() const { return pool_; }
+
+  // ===== 핫 리로드 (Linux inotify) =====
+  void setReloadCallback(ReloadCallback cb);
+  void startWatching(std::chrono::milliseconds debounce = std::chrono::milliseconds(200));
+  void stopWatching();
+  bool watching() const { return watch_thread_.joinable(); }
+
+  // 감시 없이 수동 리로드 (파일 내용이 바뀐 뒤 호출), 반환: 다시 파싱한 항목 수
+  std::size_t reload(const std::string& name);
+
+  // ===== 메모리 편집 =====
+  // 편집된 모션을 같은 이름으로 발행 (파일은 그대로, 저장 전까지 리로드 이벤트가 와도
+  // 파일 내용이 실제로 바뀐 경우에만 덮어씀). 없는 이름이면 예외
+  // expected 가 있으면 현재 모션이 그것일 때만 발행 (편집 사본을 만든 뒤 리로드 등으로
+  // 바뀌었으면 false, 호출자가 새 모션 기준으로 다시 편집)
+  bool replace(const std::string& name, std::shared_ptr<const MotionEditor> motion,
+               const std::shared_ptr<const MotionEditor>& expected = nullptr);
+
+  // 현재 모션을 원래 파일에 저장, 반환: 파일 경로
+  std::string save(const std::string& name);
+
+private:
+  struct Entry {
+    std::string path;
+    std::shared_ptr<const MotionEditor> motion;
+    // 부분 재파싱용: 최상위 항목별 텍스트 해시 / 프레임 여부
+    std::vector<std::uint64_t> item_hashes;
+    std::vector<int> item_frame; // 항목 -> 프레임 인덱스 (-1 = 메타)
+    bool incremental{false};     // 텍스트 분할 결과가 로드 결과와 일치할 때만 부분 재파싱
+    std::uint64_t text_hash{0};  // 마지막으로 읽거나 쓴 파일 내용 (자기 저장에 의한 이벤트 무시용)
+  };
+  using Map = std::unordered_map<std::string, std::shared_ptr<const Entry>>;
+
+  std::shared_ptr<const Map> snapshot() const;
+  void publish(const std::string& name, std::shared_ptr<const Entry> entry);
+
+  // path 의 내용 text 를 (가능하면 prev 기준 부분 재파싱으로) 읽어 새 항목 생성
+  std::shared_ptr<const Entry> build(const std::string& path, const std::string& text,
+                                     const Entry* prev, std::size_t& reparsed) const;
+
+  void watchLoop(std::chrono::milliseconds debounce);
+  void reloadPath(const std::string& event_path);
+  void addWatch(const std::string& dir);
+
+  MotionEditor prototype_;
+  std::shared_ptr<StringPool> pool_;
+
+  std::shared_ptr<const Map> map_;          // std::atomic_load / atomic_store 로만 접근
+  std::atomic<std::uint64_t> generation_{0};
+  std::mutex write_mu_;                     // 발행(쓰기)끼리만 직렬화
+
+  std::mutex cb_mu_;
+  ReloadCallback callback_;
+
+  std::thread watch_thread_;
+  int wake_fd_{-1};                         // 감시 스레드 종료 신호 (eventfd)
+  int inotify_fd_{-1};
+  std::mutex watch_mu_;                     // inotify_fd_ / wd_dir_ (load 가 감시 중에 디렉토리 추가)
+  std::map<int, std::string> wd_dir_;       // watch descriptor -> 디렉토리 (절대 경로)
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
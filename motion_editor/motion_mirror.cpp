@@ -0,0 +1,148 @@
+/*
+ * Motion Mirror
+ * @file motion_mirror.cpp
+ * Left/right mirroring of motions driven by a joint symmetry table.
+ *
+ * Each frame is mirrored with a gather pass: for dxl slot k,
+ *   new[k] = sign(id_k) * old[slot_of(mirrorId(id_k))]
+ * The slot gather list is compiled once per dxl layout and reused while
+ * consecutive frames share that layout (the usual case for loaded files).
+ */
+
+#include "motion_editor/motion_mirror.hpp"
+
+#include <algorithm>
+#include <filesystem>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+SymmetryTable SymmetryTable::loadFromFile(const std::string& path) {
+  YAML::Node root = YAML::LoadFile(path);
+  if (!root["pairs"] || !root["pairs"].IsSequence()) {
+    throw std::runtime_error("SymmetryTable: missing 'pairs' sequence: " + path);
+  }
+
+  SymmetryTable t;
+  for (const auto& p : root["pairs"]) {
+    const double sign = p["sign"] ? p["sign"].as<double>() : 1.0;
+    t.addPair(p["a"].as<int>(), p["b"].as<int>(), sign);
+  }
+  t.compile();
+  return t;
+}
+
+void SymmetryTable::addPair(int id_a, int id_b, double sign) {
+  if (id_a < 0 || id_b < 0) throw std::runtime_error("SymmetryTable: negative motor id");
+  pairs_.push_back(SymmetryPair{id_a, id_b, sign});
+  compiled_ = false;
+}
+
+void SymmetryTable::compile() {
+  int max_id = -1;
+  for (const auto& p : pairs_) max_id = std::max({max_id, p.id_a, p.id_b});
+
+  perm_.resize(max_id + 1);
+  sign_.assign(max_id + 1, 1.0);
+  for (int id = 0; id <= max_id; ++id) perm_[id] = id;
+
+  std::vector<bool> used(max_id + 1, false);
+  for (const auto& p : pairs_) {
+    if (used[p.id_a] || (p.id_a != p.id_b && used[p.id_b])) {
+      throw std::runtime_error("SymmetryTable: id listed twice: " +
+                               std::to_string(used[p.id_a] ? p.id_a : p.id_b));
+    }
+    used[p.id_a] = used[p.id_b] = true;
+    perm_[p.id_a] = p.id_b;
+    perm_[p.id_b] = p.id_a;
+    sign_[p.id_a] = p.sign;
+    sign_[p.id_b] = p.sign;
+  }
+  compiled_ = true;
+}
+
+MotionMirror::MotionMirror(SymmetryTable table)
+: table_(std::move(table)) {
+  // 컴파일 안 된 테이블이면 mirrorId 가 항등이라 반전 없이 저장되므로 여기서 확정
+  if (table_.pairs().empty()) throw std::runtime_error("MotionMirror: symmetry table has no pairs");
+  table_.compile();
+}
+
+void MotionMirror::apply(MotionEditor& me) const {
+  std::vector<int> layout;   // 현재 gather 리스트가 컴파일된 dxl id 순서
+  std::vector<int> src;      // slot k 가 읽어올 slot
+  std::vector<double> sgn;   // slot k 에 곱할 부호
+  std::vector<double> tmp;
+
+  for (std::size_t i = 0; i < me.frameCount(); ++i) {
+    Frame& f = me.mutableFrameAt(i);
+    const std::size_t n = f.dxl.size();
+
+    bool same = (layout.size() == n);
+    for (std::size_t k = 0; same && k < n; ++k) same = (layout[k] == f.dxl[k].id);
+
+    if (!same) {
+      layout.resize(n);
+      src.resize(n);
+      sgn.resize(n);
+      for (std::size_t k = 0; k < n; ++k) layout[k] = f.dxl[k].id;
+      for (std::size_t k = 0; k < n; ++k) {
+        const int partner = table_.mirrorId(layout[k]);
+        auto it = std::find(layout.begin(), layout.end(), partner);
+        if (it == layout.end()) {
+          // 상대편 관절이 프레임에 없으면 값 유지
+          src[k] = (int)k;
+          sgn[k] = 1.0;
+        } else {
+          src[k] = (int)(it - layout.begin());
+          sgn[k] = table_.sign(layout[k]);
+        }
+      }
+    }
+
+    tmp.resize(n);
+    for (std::size_t k = 0; k < n; ++k) tmp[k] = sgn[k] * f.dxl[src[k]].position;
+    for (std::size_t k = 0; k < n; ++k) f.dxl[k].position = tmp[k];
+  }
+}
+
+MotionEditor MotionMirror::mirrored(const MotionEditor& me) const {
+  MotionEditor out = me;
+  apply(out);
+  return out;
+}
+
+std::size_t MotionMirror::mirrorDirectory(const std::string& in_dir,
+                                          const std::string& out_dir,
+                                          const std::string& suffix) const {
+  namespace fs = std::filesystem;
+  if (!fs::is_directory(in_dir)) {
+    throw std::runtime_error("MotionMirror: not a directory: " + in_dir);
+  }
+  fs::create_directories(out_dir);
+  if (suffix.empty() && fs::equivalent(in_dir, out_dir)) {
+    throw std::runtime_error("MotionMirror: suffix required when writing into the input directory");
+  }
+
+  // 출력이 같은 디렉토리에 생길 수 있으므로 대상 목록을 먼저 확정
+  std::vector<fs::path> inputs;
+  for (const auto& entry : fs::directory_iterator(in_dir)) {
+    if (!entry.is_regular_file()) continue;
+    const auto ext = entry.path().extension();
+    if (ext == ".yaml" || ext == ".yml") inputs.push_back(entry.path());
+  }
+  std::sort(inputs.begin(), inputs.end());
+
+  std::size_t count = 0;
+  for (const auto& in : inputs) {
+    MotionEditor me;
+    me.loadFromFile(in.string());
+    apply(me);
+
+    const fs::path out = fs::path(out_dir) / (in.stem().string() + suffix + in.extension().string());
+    me.saveToFile(out.string());
+    ++count;
+  }
+  return count;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,86 @@
+/*
+ * Motion Mirror
+ * @file motion_mirror.hpp
+ * Left/right mirroring of motions driven by a joint symmetry table.
+ *
+ * Key features:
+ * - Symmetry table (id <-> id + sign flip), loadable from YAML
+ * - Compiled once into a dense permutation / sign vector
+ * - Per-frame gather pass (in place or into a new motion)
+ * - Batch mirroring of a whole motion directory
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+// 관절 대칭 테이블: id_a <-> id_b, 미러 후 위치 = sign * 상대편 위치
+// id_a == id_b 이면 자기 대칭 관절 (예: 허리 회전은 부호만 반전)
+struct SymmetryPair {
+  int id_a{};
+  int id_b{};
+  double sign{1.0};
+};
+
+class SymmetryTable {
+public:
+  SymmetryTable() = default;
+
+  // YAML 로드:
+  //   pairs:
+  //     - {a: 0, b: 1, sign: -1}
+  //     - {a: 22, b: 22, sign: -1}
+  static SymmetryTable loadFromFile(const std::string& path);
+
+  // 추가하면 다시 compile() 해야 조회에 반영됨 (MotionMirror 는 생성 시 직접 컴파일)
+  void addPair(int id_a, int id_b, double sign = 1.0);
+
+  // 모든 쌍을 id로 인덱싱되는 순열/부호 배열로 컴파일 (중복 id는 예외)
+  void compile();
+  bool compiled() const { return compiled_; }
+
+  // 컴파일된 테이블 조회 (테이블에 없는 id는 자기 자신, 부호 +1)
+  int mirrorId(int id) const {
+    return (id >= 0 && id < (int)perm_.size()) ? perm_[id] : id;
+  }
+  double sign(int id) const {
+    return (id >= 0 && id < (int)sign_.size()) ? sign_[id] : 1.0;
+  }
+
+  const std::vector<SymmetryPair>& pairs() const { return pairs_; }
+
+private:
+  std::vector<SymmetryPair> pairs_;
+  std::vector<int> perm_;     // id -> 상대편 id
+  std::vector<double> sign_;  // id -> 부호
+  bool compiled_{false};      // 마지막 addPair 이후 compile 했는지
+};
+
+// 모션 좌우 반전기
+class MotionMirror {
+public:
+  // 테이블을 컴파일해 보관 (쌍이 없거나 id 가 중복이면 예외)
+  explicit MotionMirror(SymmetryTable table);
+
+  // 제자리 반전
+  void apply(MotionEditor& me) const;
+
+  // 반전된 사본 반환 (원본 유지)
+  MotionEditor mirrored(const MotionEditor& me) const;
+
+  // in_dir 의 *.yaml / *.yml 을 모두 반전해 out_dir 에 저장, 처리한 파일 수 반환
+  // (out_dir 이 in_dir 과 같으면 suffix 가 비어 있을 수 없음)
+  std::size_t mirrorDirectory(const std::string& in_dir,
+                              const std::string& out_dir,
+                              const std::string& suffix = "") const;
+
+private:
+  SymmetryTable table_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
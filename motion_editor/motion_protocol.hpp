@@ -0,0 +1,201 @@
+/*
+ * Motion Protocol
+ * @file motion_protocol.hpp
+ * Binary wire format shared by MotionDaemon and MotionClient (Unix domain
+ * socket, same host, so integers/doubles are in host byte order).
+ *
+ * Message = 10-byte header + body:
+ *   u32 body length | u32 seq | u8 op | u8 status
+ *   - request : seq chosen by the client, status 0
+ *   - response: same seq and op as the request, status 0 = ok, 1 = error
+ *               (error body = message string)
+ *   - notice  : op Notify, seq 0, pushed to subscribed clients
+ *
+ * Body fields: str = u32 length + bytes, frame = str name, i32 time, i32 delay,
+ * i32 repeat, u8 selected, u32 n, n x (i32 id, f64 position).
+ *
+ *   op          request body                         response body
+ *   List        -                                    u32 n, n x str
+ *   Info        str motion                           u64 generation, u32 frames, str motion_name,
+ *                                                    str type, u32 n, n x i32 motor id
+ *   StepNames   str motion                           u32 n, n x str
+ *   GetFrame    str motion, str step                 frame
+ *   GetFrames   str motion, u32 first, u32 count     u32 n, n x frame (clamped to the motion)
+ *   EditJoints  str motion, str step, u32 n,         -
+ *               n x (i32 id, f64 position)
+ *   SetTiming   str motion, str step, i32 time,      -
+ *               i32 delay
+ *   Save        str motion                           str path
+ *   Reload      str motion                           u32 reparsed items
+ *   Subscribe   u8 on                                -
+ *   Notify      (server -> client)                   str motion, u8 NoticeKind, u64 generation,
+ *                                                    str error (ReloadFailed / EditDropped only)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace proto {
+
+constexpr std::size_t kHeaderSize = 10;
+constexpr std::uint32_t kMaxBody = 64u << 20; // 이보다 긴 메시지는 프로토콜 오류로 연결 종료
+
+enum class Op : std::uint8_t {
+  List = 1,
+  Info,
+  StepNames,
+  GetFrame,
+  GetFrames,
+  EditJoints,
+  SetTiming,
+  Save,
+  Reload,
+  Subscribe,
+  Notify = 0x40
+};
+
+enum class NoticeKind : std::uint8_t {
+  Edited = 1,   // 배치 하나의 편집이 발행됨
+  Saved,        // 파일에 저장됨
+  Reloaded,     // 파일이 바뀌어 다시 읽음
+  ReloadFailed, // 다시 읽기 실패 (이전 버전 유지)
+  EditDropped   // 배치 도중 파일이 다시 읽혀 새 버전에 편집을 다시 적용했는데 실패함 (예: 스텝 삭제)
+};
+
+struct Header {
+  std::uint32_t length{0};
+  std::uint32_t seq{0};
+  Op op{};
+  std::uint8_t status{0};
+};
+
+inline void putHeader(std::string& out, const Header& h) {
+  char b[kHeaderSize];
+  std::memcpy(b, &h.length, 4);
+  std::memcpy(b + 4, &h.seq, 4);
+  b[8] = (char)h.op;
+  b[9] = (char)h.status;
+  out.append(b, kHeaderSize);
+}
+
+inline Header getHeader(const char* p) {
+  Header h;
+  std::memcpy(&h.length, p, 4);
+  std::memcpy(&h.seq, p + 4, 4);
+  h.op = (Op)(std::uint8_t)p[8];
+  h.status = (std::uint8_t)p[9];
+  return h;
+}
+
+// 본문 쓰기 (out 뒤에 이어 붙임)
+class Writer {
+public:
+  explicit Writer(std::string& out) : out_(out) {}
+
+  void u8(std::uint8_t v) { out_ += (char)v; }
+  void u32(std::uint32_t v) { raw(&v, 4); }
+  void i32(std::int32_t v) { raw(&v, 4); }
+  void u64(std::uint64_t v) { raw(&v, 8); }
+  void f64(double v) { raw(&v, 8); }
+  void str(std::string_view s) {
+    u32((std::uint32_t)s.size());
+    out_.append(s.data(), s.size());
+  }
+  // selected 는 편집기의 선택 비트 (MotionEditor::isSelected), Frame::selected 는 쓰지 않음
+  void frame(const Frame& f, bool selected) {
+    str(f.name);
+    i32(f.time);
+    i32(f.delay);
+    i32(f.repeat);
+    u8(selected ? 1 : 0);
+    u32((std::uint32_t)f.dxl.size());
+    for (const auto& dv : f.dxl) {
+      i32(dv.id);
+      f64(dv.position);
+    }
+  }
+
+private:
+  void raw(const void* p, std::size_t n) { out_.append(static_cast<const char*>(p), n); }
+  std::string& out_;
+};
+
+// 본문 읽기 (범위를 넘으면 예외)
+class Reader {
+public:
+  Reader(const char* data, std::size_t size) : p_(data), end_(data + size) {}
+
+  std::uint8_t u8() { std::uint8_t v; raw(&v, 1); return v; }
+  std::uint32_t u32() { std::uint32_t v; raw(&v, 4); return v; }
+  std::int32_t i32() { std::int32_t v; raw(&v, 4); return v; }
+  std::uint64_t u64() { std::uint64_t v; raw(&v, 8); return v; }
+  double f64() { double v; raw(&v, 8); return v; }
+  std::string_view str() {
+    const std::uint32_t n = u32();
+    need(n);
+    std::string_view s(p_, n);
+    p_ += n;
+    return s;
+  }
+  Frame frame() {
+    Frame f;
+    f.name = std::string(str());
+    f.time = i32();
+    f.delay = i32();
+    f.repeat = i32();
+    f.selected = u8() != 0;
+    const std::uint32_t n = u32();
+    need((std::size_t)n * 12);
+    f.dxl.reserve(n);
+    for (std::uint32_t k = 0; k < n; ++k) {
+      const int id = i32();
+      f.dxl.push_back(DxlValue{id, f64()});
+    }
+    return f;
+  }
+  bool done() const { return p_ == end_; }
+
+  // 남은 본문이 n 바이트 이상인지 (개수 필드로 버퍼를 잡기 전에 확인)
+  void need(std::size_t n) const {
+    if ((std::size_t)(end_ - p_) < n) throw std::runtime_error("MotionProtocol: truncated message");
+  }
+
+private:
+  void raw(void* v, std::size_t n) {
+    need(n);
+    std::memcpy(v, p_, n);
+    p_ += n;
+  }
+  const char* p_;
+  const char* end_;
+};
+
+// 헤더 자리를 잡고 본문을 쓴 뒤 길이를 채움
+class Message {
+public:
+  Message(std::string& out, std::uint32_t seq, Op op, std::uint8_t status = 0)
+  : out_(out), start_(out.size()) {
+    putHeader(out_, Header{0, seq, op, status});
+  }
+  ~Message() {
+    const std::uint32_t len = (std::uint32_t)(out_.size() - start_ - kHeaderSize);
+    std::memcpy(&out_[start_], &len, 4);
+  }
+  Writer body() { return Writer(out_); }
+
+private:
+  std::string& out_;
+  std::size_t start_;
+};
+
+} // namespace proto
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,177 @@
+/*
+ * Motion Retimer
+ * @file motion_retimer.cpp
+ * Computes the minimum feasible Frame::time for every frame transition
+ * under per-joint velocity / acceleration limits.
+ *
+ * Path model:
+ * - Segment k is the straight line from frame k to frame k+1 in joint space,
+ *   parameterized by its Euclidean arc length s (rad).
+ * - On a segment, qdot = u * sdot and qddot = u * sddot (u: unit direction),
+ *   so joint limits become scalar caps on sdot and |sddot|.
+ * - At a corner the joint velocity jumps by (u_next - u_prev) * sdot; this jump
+ *   must be absorbable within junction_window_sec under the acceleration limits.
+ * - Frames with delay > 0 (hold) and the motion ends are full stops.
+ */
+
+#include "motion_editor/motion_retimer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// 한 프레임에서 ids 순서대로 위치를 꺼냄 (없는 관절은 직전 값 유지)
+// slot 캐시로 동일 레이아웃 프레임은 관절당 비교 1회
+void gatherPositions(const Frame& f, const std::vector<int>& ids,
+                     std::vector<int>& slot, std::vector<double>& q) {
+  const int n = (int)f.dxl.size();
+  for (std::size_t j = 0; j < ids.size(); ++j) {
+    int s = slot[j];
+    if (s < 0 || s >= n || f.dxl[s].id != ids[j]) {
+      s = -1;
+      for (int k = 0; k < n; ++k) {
+        if (f.dxl[k].id == ids[j]) { s = k; break; }
+      }
+      slot[j] = s;
+    }
+    if (s >= 0) q[j] = f.dxl[s].position;
+  }
+}
+
+// 경계 속도 v0, v1 / 속도 상한 vmax / 가속 상한 amax 로 길이 L 을 지나는 최소 시간 (사다리꼴 프로파일)
+double segmentDuration(double L, double v0, double v1, double vmax, double amax) {
+  if (L <= 0.0) return 0.0;
+  if (amax == kInf) return (vmax == kInf) ? 0.0 : L / vmax;
+
+  const double vpeak = std::sqrt((2.0 * amax * L + v0 * v0 + v1 * v1) * 0.5);
+  if (vpeak <= vmax) {
+    return (vpeak - v0) / amax + (vpeak - v1) / amax;
+  }
+  const double d_acc = (vmax * vmax - v0 * v0) / (2.0 * amax);
+  const double d_dec = (vmax * vmax - v1 * v1) / (2.0 * amax);
+  return (vmax - v0) / amax + (vmax - v1) / amax + (L - d_acc - d_dec) / vmax;
+}
+} // namespace
+
+MotionRetimer::MotionRetimer(const JointLimitMap& limits, const RetimeOptions& opt)
+: opt_(opt) {
+  ids_.reserve(limits.size());
+  for (const auto& [id, lim] : limits) ids_.push_back(id);
+  std::sort(ids_.begin(), ids_.end());
+
+  inv_vel_.reserve(ids_.size());
+  inv_acc_.reserve(ids_.size());
+  for (int id : ids_) {
+    const JointLimit& lim = limits.at(id);
+    inv_vel_.push_back(lim.max_velocity > 0.0 ? 1.0 / lim.max_velocity : 0.0);
+    inv_acc_.push_back(lim.max_acceleration > 0.0 ? 1.0 / lim.max_acceleration : 0.0);
+  }
+}
+
+std::vector<int> MotionRetimer::computeTimes(const MotionEditor& me) const {
+  const std::size_t n = me.frameCount();
+  std::vector<int> times(n, opt_.min_time);
+  if (n == 0) return times;
+  times[0] = me.frameAt(0).time;
+  if (n == 1 || ids_.empty()) {
+    for (std::size_t i = 1; i < n; ++i) times[i] = me.frameAt(i).time;
+    return times;
+  }
+
+  const std::size_t J = ids_.size();
+  const std::size_t m = n - 1; // 구간 수
+
+  std::vector<double> len(m), vcap(m), acap(m);
+  std::vector<double> vj(n, 0.0); // 접점(프레임) 속도 상한 -> 최종 접점 속도
+
+  std::vector<int> slot(J, -1);
+  std::vector<double> q_prev(J, 0.0), q_cur(J, 0.0);
+  std::vector<double> u_prev(J, 0.0), u_cur(J, 0.0);
+  bool prev_moving = false;
+
+  gatherPositions(me.frameAt(0), ids_, slot, q_prev);
+  q_cur = q_prev;
+
+  // 1) 구간별 길이/속도·가속 상한 + 코너 속도 상한 (한 번 순회)
+  for (std::size_t k = 0; k < m; ++k) {
+    const Frame& next = me.frameAt(k + 1);
+    gatherPositions(next, ids_, slot, q_cur);
+
+    double L2 = 0.0;
+    for (std::size_t j = 0; j < J; ++j) {
+      const double d = q_cur[j] - q_prev[j];
+      u_cur[j] = d;
+      L2 += d * d;
+    }
+    const double L = std::sqrt(L2);
+    len[k] = L;
+
+    if (L <= 0.0) {
+      vcap[k] = kInf;
+      acap[k] = kInf;
+      vj[k] = 0.0; // 정지 구간 양 끝은 정지
+      prev_moving = false;
+    } else {
+      double wv = 0.0, wa = 0.0;
+      const double inv_L = 1.0 / L;
+      for (std::size_t j = 0; j < J; ++j) {
+        u_cur[j] *= inv_L;
+        const double a = std::abs(u_cur[j]);
+        wv = std::max(wv, a * inv_vel_[j]);
+        wa = std::max(wa, a * inv_acc_[j]);
+      }
+      vcap[k] = wv > 0.0 ? 1.0 / wv : kInf;
+      acap[k] = wa > 0.0 ? 1.0 / wa : kInf;
+
+      // 프레임 k 에서의 코너: 앞 구간과 방향 변화량으로 제한
+      if (k == 0 || !prev_moving || me.frameAt(k).delay > 0) {
+        vj[k] = 0.0;
+      } else {
+        double wj = 0.0;
+        for (std::size_t j = 0; j < J; ++j) {
+          wj = std::max(wj, std::abs(u_cur[j] - u_prev[j]) * inv_acc_[j]);
+        }
+        const double corner = wj > 0.0 ? opt_.junction_window_sec / wj : kInf;
+        vj[k] = std::min({corner, vcap[k - 1], vcap[k]});
+      }
+      u_prev.swap(u_cur);
+      prev_moving = true;
+    }
+    if (k + 1 == m || next.delay > 0 || L <= 0.0) vj[k + 1] = 0.0;
+    else vj[k + 1] = kInf; // 다음 반복에서 코너 상한으로 덮어씀
+    q_prev.swap(q_cur);
+    q_cur = q_prev;
+  }
+
+  // 2) forward pass: 가속 한계로 도달 가능한 속도
+  for (std::size_t k = 0; k < m; ++k) {
+    if (acap[k] == kInf) continue;
+    vj[k + 1] = std::min(vj[k + 1], std::sqrt(vj[k] * vj[k] + 2.0 * acap[k] * len[k]));
+  }
+  // 3) backward pass: 감속 한계로 멈출 수 있는 속도
+  for (std::size_t k = m; k-- > 0;) {
+    if (acap[k] == kInf) continue;
+    vj[k] = std::min(vj[k], std::sqrt(vj[k + 1] * vj[k + 1] + 2.0 * acap[k] * len[k]));
+  }
+
+  // 4) 구간 시간 -> Frame::time 단위로 올림
+  for (std::size_t k = 0; k < m; ++k) {
+    const double t = segmentDuration(len[k], vj[k], vj[k + 1], vcap[k], acap[k]);
+    const double ticks = std::ceil(t / opt_.tick_sec - 1e-9);
+    times[k + 1] = std::max(opt_.min_time, (int)ticks);
+  }
+  return times;
+}
+
+void MotionRetimer::apply(MotionEditor& me) const {
+  const std::vector<int> times = computeTimes(me);
+  // 시간이 그대로인 프레임은 복사하지 않고, 관절 구역 요약도 건드리지 않음
+  for (std::size_t i = 1; i < times.size(); ++i) me.setFrameTiming(i, times[i]);
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
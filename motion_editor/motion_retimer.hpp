@@ -0,0 +1,54 @@
+/*
+ * Motion Retimer
+ * @file motion_retimer.hpp
+ * Computes the minimum feasible Frame::time for every frame transition
+ * under per-joint velocity / acceleration limits.
+ *
+ * Key features:
+ * - Treats the motion as a piecewise-linear path in joint space
+ * - TOPP-style forward/backward pass over junction speeds (linear time)
+ * - Writes the resulting transition times back into Frame::time
+ */
+
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct JointLimit {
+  double max_velocity{0.0};     // rad/s   (<= 0 이면 제한 없음)
+  double max_acceleration{0.0}; // rad/s^2 (<= 0 이면 제한 없음)
+};
+
+// 모터ID -> 관절 제한
+using JointLimitMap = std::unordered_map<int, JointLimit>;
+
+struct RetimeOptions {
+  double tick_sec{0.001};           // Frame::time 1 단위의 초 (기본 ms)
+  double junction_window_sec{0.02}; // 코너에서 속도 불연속을 흡수하는 시간 (서보 보간 주기 수준)
+  int min_time{1};                  // 정지 구간 등에 쓰는 최소 time
+};
+
+// 관절 제한 기반 최소 시간 리타이머
+class MotionRetimer {
+public:
+  explicit MotionRetimer(const JointLimitMap& limits, const RetimeOptions& opt = RetimeOptions{});
+
+  // 프레임별 최소 time 계산 (결과[0]은 이전 프레임이 없으므로 원래 값 유지)
+  std::vector<int> computeTimes(const MotionEditor& me) const;
+
+  // computeTimes 결과를 Frame::time 에 반영
+  void apply(MotionEditor& me) const;
+
+private:
+  std::vector<int> ids_;          // 제한이 걸린 모터ID (오름차순)
+  std::vector<double> inv_vel_;   // 1 / max_velocity (0 = 무제한)
+  std::vector<double> inv_acc_;   // 1 / max_acceleration (0 = 무제한)
+  RetimeOptions opt_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
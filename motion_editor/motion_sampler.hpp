@@ -0,0 +1,129 @@
+/*
+ * Motion Sampler
+ * @file motion_sampler.hpp
+ * Time-based pose sampling shared by every frame container
+ * (MotionEditor, MotionSequence, ...).
+ *
+ * Timeline:
+ * - Frame i is reached at A_i = sum(time[0..i]) + sum(delay[0..i-1])
+ *   and held until H_i = A_i + delay[i].
+ * - Between H_{i-1} and A_i the pose is linearly interpolated per joint.
+ * - Before A_0 the first pose, after the last frame the last pose is returned.
+ * - repeat is not expanded (played once).
+ *
+ * Source requirements (duck-typed):
+ *   std::size_t size() const;
+ *   const F& operator[](std::size_t) const;   // F: time, delay, name, dxl[k].id/.position, dxl.size()
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+// MotionEditor 를 Source 요구사항에 맞추는 어댑터
+struct EditorFrames {
+  const MotionEditor& me;
+  std::size_t size() const { return me.frameCount(); }
+  const Frame& operator[](std::size_t i) const { return me.frameAt(i); }
+};
+
+// 이름으로 첫 프레임 인덱스 찾기 (없으면 -1)
+template <class Source>
+long findFrameIndex(const Source& src, std::string_view name) {
+  for (std::size_t i = 0; i < src.size(); ++i) {
+    if (std::string_view(src[i].name) == name) return (long)i;
+  }
+  return -1;
+}
+
+template <class Source>
+class TimelineSampler {
+public:
+  // Source 는 값으로 보관하므로 가벼운 뷰 타입을 넘길 것 (EditorFrames, MotionSequence 등)
+  explicit TimelineSampler(Source src)
+  : src_(std::move(src)) {
+    arrive_.resize(src_.size());
+    double t = 0.0;
+    for (std::size_t i = 0; i < src_.size(); ++i) {
+      t += src_[i].time;
+      arrive_[i] = t;
+      t += src_[i].delay;
+    }
+    duration_ = t;
+  }
+
+  double duration() const { return duration_; }
+  double arrivalTime(std::size_t i) const { return arrive_[i]; }
+
+  // t 시점 자세를 out 에 기록 (레이아웃은 다음 프레임 기준)
+  // 순차 재생 시 커서 덕분에 샘플당 O(1), 임의 접근 시 이진 탐색
+  void sample(double t, std::vector<DxlValue>& out) {
+    const std::size_t n = src_.size();
+    out.clear();
+    if (n == 0) return;
+
+    // 커서 = arrive_[i] >= t 인 첫 프레임 (lower_bound)
+    auto valid = [&](std::size_t c) {
+      return (c == n || arrive_[c] >= t) && (c == 0 || arrive_[c - 1] < t);
+    };
+    if (!valid(cursor_)) {
+      std::size_t c = cursor_;
+      while (c < n && arrive_[c] < t && c - cursor_ < 4) ++c; // 순차 재생이면 몇 칸 전진으로 충분
+      cursor_ = valid(c) ? c
+        : (std::size_t)(std::lower_bound(arrive_.begin(), arrive_.end(), t) - arrive_.begin());
+    }
+
+    if (cursor_ == 0) { copyPose(src_[0], out); return; }
+    if (cursor_ >= n) { copyPose(src_[n - 1], out); return; }
+
+    const auto& prev = src_[cursor_ - 1];
+    const auto& next = src_[cursor_];
+    const double hold_end = arrive_[cursor_ - 1] + prev.delay;
+    if (t <= hold_end) { copyPose(prev, out); return; }
+
+    const double span = arrive_[cursor_] - hold_end;
+    const double w = span > 0.0 ? (t - hold_end) / span : 1.0;
+    interpolate(prev, next, w, out);
+  }
+
+private:
+  template <class F>
+  static void copyPose(const F& f, std::vector<DxlValue>& out) {
+    out.resize(f.dxl.size());
+    for (std::size_t k = 0; k < f.dxl.size(); ++k) out[k] = DxlValue{f.dxl[k].id, f.dxl[k].position};
+  }
+
+  template <class F>
+  static void interpolate(const F& a, const F& b, double w, std::vector<DxlValue>& out) {
+    const std::size_t nb = b.dxl.size();
+    const std::size_t na = a.dxl.size();
+    out.resize(nb);
+    for (std::size_t k = 0; k < nb; ++k) {
+      const int id = b.dxl[k].id;
+      const double qb = b.dxl[k].position;
+      double qa = qb; // 이전 프레임에 없는 관절은 보간 없이 목표 값
+      if (k < na && a.dxl[k].id == id) {
+        qa = a.dxl[k].position;
+      } else {
+        for (std::size_t s = 0; s < na; ++s) {
+          if (a.dxl[s].id == id) { qa = a.dxl[s].position; break; }
+        }
+      }
+      out[k] = DxlValue{id, qa + w * (qb - qa)};
+    }
+  }
+
+  Source src_;
+  std::vector<double> arrive_;
+  double duration_{0.0};
+  std::size_t cursor_{0};
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
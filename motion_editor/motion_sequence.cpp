@@ -0,0 +1,115 @@
+/*
+ * Motion Sequence
+ * @file motion_sequence.cpp
+ * Zero-copy composition of frame ranges taken from one or more motions.
+ */
+
+#include "motion_editor/motion_sequence.hpp"
+
+#include <algorithm>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+MotionSequence& MotionSequence::append(std::shared_ptr<const MotionEditor> src) {
+  const std::size_t n = src ? src->frameCount() : 0;
+  return append(std::move(src), 0, n);
+}
+
+MotionSequence& MotionSequence::append(std::shared_ptr<const MotionEditor> src,
+                                       std::size_t begin, std::size_t end) {
+  if (!src) throw std::runtime_error("MotionSequence: null source motion");
+  if (begin > end || end > src->frameCount()) {
+    throw std::runtime_error("MotionSequence: frame range out of bounds");
+  }
+  if (begin == end) return *this;
+
+  spans_.push_back(Span{std::move(src), begin, end});
+  offsets_.push_back(size() + (end - begin));
+  return *this;
+}
+
+MotionSequence& MotionSequence::appendRepeated(std::shared_ptr<const MotionEditor> src,
+                                               std::size_t begin, std::size_t end,
+                                               std::size_t count) {
+  for (std::size_t k = 0; k < count; ++k) append(src, begin, end);
+  return *this;
+}
+
+const Frame& MotionSequence::operator[](std::size_t i) const {
+  std::size_t pos;
+  const Span& s = locate(i, pos);
+  return s.src->frameAt(pos);
+}
+
+bool MotionSequence::isSelected(std::size_t i) const {
+  std::size_t pos;
+  const Span& s = locate(i, pos);
+  return s.src->isSelected(pos);
+}
+
+const MotionSequence::Span& MotionSequence::locate(std::size_t i, std::size_t& pos) const {
+  if (i >= size()) throw std::out_of_range("MotionSequence: index out of range");
+  // offsets_[k] > i 인 첫 구간
+  const std::size_t k = (std::size_t)(std::upper_bound(offsets_.begin(), offsets_.end(), i) - offsets_.begin());
+  const std::size_t span_start = (k == 0) ? 0 : offsets_[k - 1];
+  const Span& s = spans_[k];
+  pos = s.begin + (i - span_start);
+  return s;
+}
+
+MotionSequence::const_iterator::const_iterator(const Span* spans, std::size_t n_spans,
+                                               std::size_t span, std::size_t pos)
+: spans_(spans), n_spans_(n_spans), span_(span), pos_(pos) {
+  skipEmpty();
+}
+
+void MotionSequence::const_iterator::skipEmpty() {
+  while (span_ < n_spans_ && pos_ >= spans_[span_].end) {
+    ++span_;
+    pos_ = (span_ < n_spans_) ? spans_[span_].begin : 0;
+  }
+}
+
+MotionSequence::const_iterator& MotionSequence::const_iterator::operator++() {
+  ++pos_;
+  skipEmpty();
+  return *this;
+}
+
+MotionSequence::const_iterator MotionSequence::begin() const {
+  if (spans_.empty()) return end();
+  return const_iterator(spans_.data(), spans_.size(), 0, spans_.front().begin);
+}
+
+MotionSequence::const_iterator MotionSequence::end() const {
+  return const_iterator(spans_.data(), spans_.size(), spans_.size(), 0);
+}
+
+void MotionSequence::saveToFile(const std::string& path) const {
+  YAML::Node out(YAML::NodeType::Sequence);
+  if (!spans_.empty()) spans_.front().src->appendMetaNodes(out);
+  for (auto it = begin(); it != end(); ++it) {
+    YAML::Node node = MotionEditor::frameToNode(*it);
+    if (it.selected() != it->selected) node["selected"] = it.selected();
+    out.push_back(node);
+  }
+
+  std::ofstream ofs(path);
+  if (!ofs) throw std::runtime_error("MotionSequence: cannot open file to write: " + path);
+  ofs << out;
+}
+
+MotionEditor MotionSequence::materialize() const {
+  if (spans_.empty()) return MotionEditor();
+
+  MotionEditor out = *spans_.front().src;
+  out.clearFrames();
+  for (auto it = begin(); it != end(); ++it) {
+    Frame f = *it;
+    f.selected = it.selected(); // appendFrame 이 선택 비트를 여기서 가져감
+    out.appendFrame(std::move(f));
+  }
+  return out;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,97 @@
+/*
+ * Motion Sequence
+ * @file motion_sequence.hpp
+ * Zero-copy composition of frame ranges taken from one or more motions
+ * (e.g. intro + N x gait cycle + outro).
+ *
+ * Key features:
+ * - Spans reference source frames; no Frame is copied while composing
+ * - Indexing / iteration / sampling as if it were a single motion
+ * - Save straight from the referenced frames
+ * - materialize() copies into a MotionEditor only when an edit is needed
+ */
+
+#pragma once
+
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+class MotionSequence {
+public:
+  // 원본 모션의 [begin, end) 프레임 구간 참조
+  struct Span {
+    std::shared_ptr<const MotionEditor> src;
+    std::size_t begin{0};
+    std::size_t end{0};
+  };
+
+  MotionSequence() = default;
+
+  // 원본 전체 / 일부 구간 / 구간 반복 추가 (원본은 시퀀스 사용 중 수정하지 말 것)
+  MotionSequence& append(std::shared_ptr<const MotionEditor> src);
+  MotionSequence& append(std::shared_ptr<const MotionEditor> src, std::size_t begin, std::size_t end);
+  MotionSequence& appendRepeated(std::shared_ptr<const MotionEditor> src,
+                                 std::size_t begin, std::size_t end, std::size_t count);
+
+  std::size_t size() const { return offsets_.empty() ? 0 : offsets_.back(); }
+  const std::vector<Span>& spans() const { return spans_; }
+
+  // 전역 인덱스 -> 원본 프레임 (구간 수에 대해 이진 탐색)
+  const Frame& operator[](std::size_t i) const;
+  // 원본 편집기의 선택 비트 (Frame::selected 는 로드 당시 값일 수 있음)
+  bool isSelected(std::size_t i) const;
+
+  // 순방향 반복자: 구간/오프셋을 들고 다녀 증가가 O(1)
+  class const_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Frame;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Frame*;
+    using reference = const Frame&;
+
+    const_iterator() = default;
+    reference operator*() const { return spans_[span_].src->frameAt(pos_); }
+    pointer operator->() const { return &**this; }
+    const_iterator& operator++();
+    const_iterator operator++(int) { const_iterator t = *this; ++*this; return t; }
+    bool operator==(const const_iterator& o) const { return span_ == o.span_ && pos_ == o.pos_; }
+    bool operator!=(const const_iterator& o) const { return !(*this == o); }
+    // 현재 프레임의 원본 선택 비트
+    bool selected() const { return spans_[span_].src->isSelected(pos_); }
+
+  private:
+    friend class MotionSequence;
+    const_iterator(const Span* spans, std::size_t n_spans, std::size_t span, std::size_t pos);
+    void skipEmpty();
+
+    const Span* spans_{nullptr};
+    std::size_t n_spans_{0};
+    std::size_t span_{0};
+    std::size_t pos_{0};
+  };
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // 첫 구간 원본의 메타 항목 + 참조 프레임으로 저장 (selected 는 각 원본의 선택 비트)
+  void saveToFile(const std::string& path) const;
+
+  // 편집이 필요할 때 하나의 MotionEditor 로 복사 (메타/매핑은 첫 구간 원본 기준)
+  MotionEditor materialize() const;
+
+private:
+  // 전역 인덱스 -> 구간 + 원본 프레임 인덱스
+  const Span& locate(std::size_t i, std::size_t& pos) const;
+
+  std::vector<Span> spans_;
+  std::vector<std::size_t> offsets_; // offsets_[k] = spans_[0..k] 누적 프레임 수
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
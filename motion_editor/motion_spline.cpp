@@ -0,0 +1,334 @@
+/*
+ * Motion Spline
+ * @file motion_spline.cpp
+ * Greedy Hermite fitting, cursor evaluation and the binary spline format.
+ *
+ * Segment [s0, s1], h = s1 - s0, u = s - s0, knot values y0/y1, slopes m0/m1:
+ *   q(u) = a + b u + c u^2 + d u^3
+ *   a = y0, b = m0, c = (3 D - 2 m0 - m1) / h, d = (m0 + m1 - 2 D) / h^2,  D = (y1 - y0) / h
+ *
+ * File layout (all little-endian):
+ *   "MSPL" u32 version
+ *   str motion_name, str type, u32 n + i32 motor_ids[n]
+ *   u32 frames, per frame: i32 time, i32 delay, i32 repeat, u8 selected, str name
+ *   u32 joints, per joint: i32 id, u32 knots, per knot: u32 s, f64 y, f64 m
+ *   (str = u32 length + bytes)
+ */
+
+#include "motion_editor/motion_spline.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+
+#include "motion_editor/joint_columns.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+constexpr char kMagic[4] = {'M', 'S', 'P', 'L'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kMaxSegment = 64; // 적합 시 구간 최대 길이 (프레임), 적합 비용 상한
+
+// 구간 [0, h] Hermite 값
+double hermite(double y0, double y1, double m0, double m1, double h, double u) {
+  const double D = (y1 - y0) / h;
+  const double c = (3.0 * D - 2.0 * m0 - m1) / h;
+  const double d = (m0 + m1 - 2.0 * D) / (h * h);
+  return y0 + u * (m0 + u * (c + u * d));
+}
+
+void writeU32(std::ofstream& os, std::uint32_t v) { os.write(reinterpret_cast<const char*>(&v), sizeof v); }
+void writeI32(std::ofstream& os, std::int32_t v) { os.write(reinterpret_cast<const char*>(&v), sizeof v); }
+void writeF64(std::ofstream& os, double v) { os.write(reinterpret_cast<const char*>(&v), sizeof v); }
+void writeStr(std::ofstream& os, const std::string& s) {
+  writeU32(os, (std::uint32_t)s.size());
+  os.write(s.data(), (std::streamsize)s.size());
+}
+
+template <class T>
+T readPod(std::ifstream& is) {
+  T v{};
+  if (!is.read(reinterpret_cast<char*>(&v), sizeof v)) throw std::runtime_error("MotionSpline: truncated file");
+  return v;
+}
+std::string readStr(std::ifstream& is) {
+  const auto n = readPod<std::uint32_t>(is);
+  std::string s(n, '\0');
+  if (n && !is.read(&s[0], n)) throw std::runtime_error("MotionSpline: truncated file");
+  return s;
+}
+} // namespace
+
+// ===== 적합 =====
+
+MotionSpline MotionSpline::fit(const MotionEditor& me, double tolerance, const std::vector<int>& ids) {
+  if (tolerance < 0.0) throw std::runtime_error("MotionSpline: tolerance must be >= 0");
+
+  MotionSpline sp;
+  sp.motion_name_ = me.motionName();
+  sp.motion_type_ = me.motionType();
+  sp.motor_ids_ = me.motorIds();
+  sp.frames_.reserve(me.frameCount());
+  for (std::size_t i = 0; i < me.frameCount(); ++i) {
+    const Frame& f = me.frameAt(i);
+    sp.frames_.push_back(FrameInfo{f.time, f.delay, f.repeat, me.isSelected(i), f.name});
+  }
+  sp.buildTimeline();
+
+  const JointColumns cols = ids.empty() ? JointColumns::extractAll(me) : JointColumns::extract(me, ids);
+  const std::size_t N = cols.frames();
+  std::vector<double> m(N, 0.0);
+  std::vector<std::uint32_t> ks;
+  std::vector<double> ys, ms;
+
+  for (std::size_t j = 0; j < cols.joints(); ++j) {
+    const double* y = cols.column(j);
+    // 중앙 차분 기울기 (양 끝은 한쪽 차분)
+    for (std::size_t i = 0; i < N; ++i) {
+      if (N < 2) m[i] = 0.0;
+      else if (i == 0) m[i] = y[1] - y[0];
+      else if (i + 1 == N) m[i] = y[i] - y[i - 1];
+      else m[i] = 0.5 * (y[i + 1] - y[i - 1]);
+    }
+
+    ks.clear(); ys.clear(); ms.clear();
+    std::size_t k = 0;
+    while (N) {
+      ks.push_back((std::uint32_t)k);
+      ys.push_back(y[k]);
+      ms.push_back(m[k]);
+      if (k + 1 >= N) break;
+
+      // 건너뛴 키프레임이 모두 허용치 안인 동안 구간 연장
+      std::size_t e = k + 1;
+      while (e + 1 < N && e + 1 - k <= kMaxSegment) {
+        const std::size_t cand = e + 1;
+        const double h = (double)(cand - k);
+        bool ok = true;
+        for (std::size_t i = k + 1; i < cand && ok; ++i) {
+          ok = std::abs(hermite(y[k], y[cand], m[k], m[cand], h, (double)(i - k)) - y[i]) <= tolerance;
+        }
+        if (!ok) break;
+        e = cand;
+      }
+      k = e;
+    }
+    sp.appendJoint(cols.ids()[j], ks, ys, ms);
+  }
+  return sp;
+}
+
+void MotionSpline::appendJoint(int id, const std::vector<std::uint32_t>& ks, const std::vector<double>& ys,
+                               const std::vector<double>& ms) {
+  ids_.push_back(id);
+  if (ks.size() == 1) {
+    // 프레임 1개: 상수 구간
+    seg_s0_.push_back(ks[0]);
+    coef_.insert(coef_.end(), {ys[0], 0.0, 0.0, 0.0});
+  }
+  for (std::size_t k = 0; k + 1 < ks.size(); ++k) {
+    const double h = (double)ks[k + 1] - (double)ks[k];
+    const double D = (ys[k + 1] - ys[k]) / h;
+    seg_s0_.push_back(ks[k]);
+    coef_.insert(coef_.end(), {ys[k], ms[k], (3.0 * D - 2.0 * ms[k] - ms[k + 1]) / h,
+                               (ms[k] + ms[k + 1] - 2.0 * D) / (h * h)});
+  }
+  seg_begin_.push_back((std::uint32_t)seg_s0_.size());
+}
+
+void MotionSpline::buildTimeline() {
+  arrive_.resize(frames_.size());
+  double t = 0.0;
+  for (std::size_t i = 0; i < frames_.size(); ++i) {
+    t += frames_[i].time;
+    arrive_[i] = t;
+    t += frames_[i].delay;
+  }
+  duration_ = t;
+}
+
+// ===== 평가 =====
+
+std::uint32_t MotionSpline::seekSegment(std::size_t joint, std::uint32_t seg, double s) const {
+  const std::uint32_t b = seg_begin_[joint], e = seg_begin_[joint + 1];
+  if (seg < b || seg >= e || seg_s0_[seg] > s) seg = b;
+  // 순차 재생이면 몇 칸 전진으로 충분, 멀면 이진 탐색
+  for (int step = 0; step < 4; ++step) {
+    if (seg + 1 >= e || seg_s0_[seg + 1] > s) return seg;
+    ++seg;
+  }
+  auto it = std::upper_bound(seg_s0_.begin() + seg, seg_s0_.begin() + e, s);
+  return (std::uint32_t)(it - seg_s0_.begin()) - 1;
+}
+
+double MotionSpline::evaluate(std::size_t joint, double s) const {
+  if (joint >= ids_.size()) throw std::out_of_range("MotionSpline: joint index out of range");
+  return evalSegment(seekSegment(joint, seg_begin_[joint], s), s);
+}
+
+void MotionSpline::sample(double t, SplineCursor& cursor, std::vector<DxlValue>& out) const {
+  const std::size_t n = frames_.size();
+  out.clear();
+  if (n == 0) return;
+
+  // t -> s (도착 구간 전진 / 유지 구간은 해당 프레임 / 이동 구간은 선형)
+  std::size_t c = std::min(cursor.frame, n);
+  const std::size_t start = c;
+  while (c < n && arrive_[c] < t && c - start < 4) ++c; // 순차 재생이면 몇 칸 전진으로 충분
+  if ((c < n && arrive_[c] < t) || (c > 0 && arrive_[c - 1] >= t)) {
+    c = (std::size_t)(std::lower_bound(arrive_.begin(), arrive_.end(), t) - arrive_.begin());
+  }
+  cursor.frame = c;
+
+  double s;
+  if (c == 0) s = 0.0;
+  else if (c >= n) s = (double)(n - 1);
+  else {
+    const double hold_end = arrive_[c - 1] + frames_[c - 1].delay;
+    const double span = arrive_[c] - hold_end;
+    s = (double)(c - 1);
+    if (t > hold_end) s += span > 0.0 ? (t - hold_end) / span : 1.0;
+  }
+
+  if (cursor.seg.size() != ids_.size()) cursor.seg.assign(seg_begin_.begin(), seg_begin_.end() - 1);
+  out.resize(ids_.size());
+  for (std::size_t j = 0; j < ids_.size(); ++j) {
+    const std::uint32_t seg = seekSegment(j, cursor.seg[j], s);
+    cursor.seg[j] = seg;
+    out[j] = DxlValue{ids_[j], evalSegment(seg, s)};
+  }
+}
+
+Frame MotionSpline::frame(std::size_t i) const {
+  const FrameInfo& fi = frames_.at(i);
+  Frame f;
+  f.time = fi.time;
+  f.delay = fi.delay;
+  f.repeat = fi.repeat;
+  f.selected = fi.selected;
+  f.name = fi.name;
+  f.dxl.reserve(ids_.size());
+  for (std::size_t j = 0; j < ids_.size(); ++j) f.dxl.push_back(DxlValue{ids_[j], evaluate(j, (double)i)});
+  return f;
+}
+
+void MotionSpline::toEditor(MotionEditor& me) const {
+  me.clearFrames();
+  me.setMotionName(motion_name_);
+  me.setMotionType(motion_type_);
+  me.setMotorIds(motor_ids_);
+
+  std::vector<std::uint32_t> seg(seg_begin_.begin(), seg_begin_.end() - 1);
+  for (std::size_t i = 0; i < frames_.size(); ++i) {
+    const FrameInfo& fi = frames_[i];
+    Frame f;
+    f.time = fi.time;
+    f.delay = fi.delay;
+    f.repeat = fi.repeat;
+    f.selected = fi.selected;
+    f.name = fi.name;
+    f.dxl.reserve(ids_.size());
+    for (std::size_t j = 0; j < ids_.size(); ++j) {
+      seg[j] = seekSegment(j, seg[j], (double)i);
+      f.dxl.push_back(DxlValue{ids_[j], evalSegment(seg[j], (double)i)});
+    }
+    me.appendFrame(std::move(f));
+  }
+}
+
+// ===== 파일 =====
+
+void MotionSpline::saveToFile(const std::string& path) const {
+  std::ofstream os(path, std::ios::binary);
+  if (!os) throw std::runtime_error("MotionSpline: cannot open file to write: " + path);
+
+  os.write(kMagic, sizeof kMagic);
+  writeU32(os, kVersion);
+  writeStr(os, motion_name_);
+  writeStr(os, motion_type_);
+  writeU32(os, (std::uint32_t)motor_ids_.size());
+  for (int id : motor_ids_) writeI32(os, id);
+
+  writeU32(os, (std::uint32_t)frames_.size());
+  for (const auto& fi : frames_) {
+    writeI32(os, fi.time);
+    writeI32(os, fi.delay);
+    writeI32(os, fi.repeat);
+    os.put(fi.selected ? 1 : 0);
+    writeStr(os, fi.name);
+  }
+
+  // 매듭 = 각 구간 시작 (a, b) + 마지막 구간 끝 (값/미분 계산)
+  writeU32(os, (std::uint32_t)ids_.size());
+  for (std::size_t j = 0; j < ids_.size(); ++j) {
+    const std::uint32_t b = seg_begin_[j], e = seg_begin_[j + 1];
+    const bool single = frames_.size() < 2;
+    writeI32(os, ids_[j]);
+    writeU32(os, single ? (e - b) : (e - b + 1));
+    for (std::uint32_t k = b; k < e; ++k) {
+      writeU32(os, (std::uint32_t)seg_s0_[k]);
+      writeF64(os, coef_[4 * k]);
+      writeF64(os, coef_[4 * k + 1]);
+    }
+    if (!single && e > b) {
+      const double* c = &coef_[4 * (e - 1)];
+      const double s1 = (double)(frames_.size() - 1), h = s1 - seg_s0_[e - 1];
+      writeU32(os, (std::uint32_t)s1);
+      writeF64(os, c[0] + h * (c[1] + h * (c[2] + h * c[3])));
+      writeF64(os, c[1] + h * (2.0 * c[2] + 3.0 * h * c[3]));
+    }
+  }
+  if (!os) throw std::runtime_error("MotionSpline: write failed: " + path);
+}
+
+MotionSpline MotionSpline::loadFromFile(const std::string& path) {
+  std::ifstream is(path, std::ios::binary);
+  if (!is) throw std::runtime_error("MotionSpline: cannot open file: " + path);
+
+  char magic[4];
+  if (!is.read(magic, sizeof magic) || std::memcmp(magic, kMagic, sizeof magic) != 0) {
+    throw std::runtime_error("MotionSpline: not a spline file: " + path);
+  }
+  if (readPod<std::uint32_t>(is) != kVersion) throw std::runtime_error("MotionSpline: unsupported version: " + path);
+
+  MotionSpline sp;
+  sp.motion_name_ = readStr(is);
+  sp.motion_type_ = readStr(is);
+  sp.motor_ids_.resize(readPod<std::uint32_t>(is));
+  for (auto& id : sp.motor_ids_) id = readPod<std::int32_t>(is);
+
+  sp.frames_.resize(readPod<std::uint32_t>(is));
+  for (auto& fi : sp.frames_) {
+    fi.time = readPod<std::int32_t>(is);
+    fi.delay = readPod<std::int32_t>(is);
+    fi.repeat = readPod<std::int32_t>(is);
+    fi.selected = readPod<std::uint8_t>(is) != 0;
+    fi.name = readStr(is);
+  }
+  sp.buildTimeline();
+
+  const auto joints = readPod<std::uint32_t>(is);
+  std::vector<std::uint32_t> ks;
+  std::vector<double> ys, ms;
+  for (std::uint32_t j = 0; j < joints; ++j) {
+    const int id = readPod<std::int32_t>(is);
+    const auto knots = readPod<std::uint32_t>(is);
+    ks.resize(knots); ys.resize(knots); ms.resize(knots);
+    for (std::uint32_t k = 0; k < knots; ++k) {
+      ks[k] = readPod<std::uint32_t>(is);
+      ys[k] = readPod<double>(is);
+      ms[k] = readPod<double>(is);
+      if (k > 0 && ks[k] <= ks[k - 1]) throw std::runtime_error("MotionSpline: knots out of order: " + path);
+    }
+    if (sp.frames_.empty() ? knots != 0
+        : (knots == 0 || ks.front() != 0 || ks.back() + 1 != sp.frames_.size())) {
+      throw std::runtime_error("MotionSpline: knots do not cover the frames: " + path);
+    }
+    sp.appendJoint(id, ks, ys, ms);
+  }
+  return sp;
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
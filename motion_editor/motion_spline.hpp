@@ -0,0 +1,99 @@
+/*
+ * Motion Spline
+ * @file motion_spline.hpp
+ * Compact motion form: per-joint piecewise cubic Hermite splines fitted to the
+ * keyframes within a position tolerance, instead of dense dxl lists.
+ *
+ * Key features:
+ * - Spline parameter s = frame index (keyframe i at s = i), knots are a subset
+ *   of the keyframes per joint; slopes come from central differences
+ * - Greedy fit: a segment grows while every skipped keyframe stays within tolerance
+ * - Evaluation uses precomputed power-basis coefficients (a, b, c, d) packed per
+ *   segment, one contiguous block per joint
+ * - SplineCursor makes sequential playback O(1) per sample (same timeline as
+ *   motion_sampler.hpp: arrival / hold / move)
+ * - Own binary format (knots only, coefficients rebuilt on load)
+ * - Converted back to frames on demand (every frame gets every fitted joint)
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+// 순차 재생용 커서 (스플라인마다 하나, 처음 sample 호출 때 크기 맞춤)
+struct SplineCursor {
+  std::size_t frame{0};            // arrival[frame] >= t 인 첫 프레임
+  std::vector<std::uint32_t> seg;  // 관절별 현재 구간 (전역 구간 인덱스)
+};
+
+class MotionSpline {
+public:
+  MotionSpline() = default;
+
+  // 편집기 모션을 관절별 스플라인으로 적합 (ids 비우면 모션의 모든 관절)
+  //   tolerance: 키프레임 위치 오차 허용치 [rad] (0 = 모든 키프레임이 매듭)
+  static MotionSpline fit(const MotionEditor& me, double tolerance, const std::vector<int>& ids = {});
+
+  // 전용 바이너리 형식 (little-endian)
+  void saveToFile(const std::string& path) const;
+  static MotionSpline loadFromFile(const std::string& path);
+
+  std::size_t frameCount() const { return frames_.size(); }
+  std::size_t joints() const { return ids_.size(); }
+  const std::vector<int>& ids() const { return ids_; }
+  std::size_t segmentCount() const { return seg_s0_.size(); }
+  std::size_t segmentCount(std::size_t joint) const { return seg_begin_[joint + 1] - seg_begin_[joint]; }
+  double duration() const { return duration_; }
+
+  // 관절 열 joint 의 s 위치 값 (임의 접근, 구간 이진 탐색)
+  double evaluate(std::size_t joint, double s) const;
+
+  // t 시점 자세 (ids() 순서), 순차 재생이면 커서 덕분에 샘플당 O(1)
+  void sample(double t, SplineCursor& cursor, std::vector<DxlValue>& out) const;
+
+  // 프레임 복원 (dxl 은 ids() 순서)
+  Frame frame(std::size_t i) const;
+  // 편집기 프레임을 통째로 교체하고 메타(name / type / motor id)를 설정
+  void toEditor(MotionEditor& me) const;
+
+private:
+  struct FrameInfo {
+    int time{0};
+    int delay{0};
+    int repeat{0};
+    bool selected{false};
+    std::string name;
+  };
+
+  // 매듭 (s, 값, 기울기) 목록으로 joint 의 구간 추가
+  void appendJoint(int id, const std::vector<std::uint32_t>& ks, const std::vector<double>& ys,
+                   const std::vector<double>& ms);
+  void buildTimeline();
+  // seg 에서 출발해 s 를 포함하는 구간 (joint 범위 안)
+  std::uint32_t seekSegment(std::size_t joint, std::uint32_t seg, double s) const;
+  double evalSegment(std::uint32_t seg, double s) const {
+    const double u = s - seg_s0_[seg];
+    const double* c = &coef_[4 * seg];
+    return c[0] + u * (c[1] + u * (c[2] + u * c[3]));
+  }
+
+  std::string motion_name_;
+  std::string motion_type_;
+  std::vector<int> motor_ids_;
+  std::vector<FrameInfo> frames_;
+  std::vector<double> arrive_; // 프레임 도착 시각 (motion_sampler.hpp 와 같은 타임라인)
+  double duration_{0.0};
+
+  std::vector<int> ids_;
+  std::vector<std::uint32_t> seg_begin_{0}; // joint j 구간 = [seg_begin_[j], seg_begin_[j+1])
+  std::vector<double> seg_s0_;              // 구간 시작 s
+  std::vector<double> coef_;                // 구간당 a, b, c, d (u = s - s0)
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
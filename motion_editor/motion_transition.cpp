@@ -0,0 +1,96 @@
+/*
+ * Motion Transition
+ * @file motion_transition.cpp
+ * Generates crossfade frames between the last frame of one motion and the
+ * first frame of another.
+ */
+
+#include "motion_editor/motion_transition.hpp"
+
+#include <cmath>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace {
+double blendWeight(BlendCurve c, double w) {
+  switch (c) {
+    case BlendCurve::Linear:      return w;
+    case BlendCurve::Smoothstep:  return w * w * (3.0 - 2.0 * w);
+    case BlendCurve::Cosine:      return 0.5 * (1.0 - std::cos(M_PI * w));
+    case BlendCurve::MinimumJerk: return w * w * w * (10.0 + w * (-15.0 + 6.0 * w));
+  }
+  return w;
+}
+} // namespace
+
+TransitionBuilder::TransitionBuilder(const TransitionOptions& opt)
+: opt_(opt) {
+  if (opt_.steps < 1) throw std::runtime_error("TransitionBuilder: steps must be >= 1");
+
+  weights_.resize(opt_.steps);
+  times_.resize(opt_.steps);
+  int prev_t = 0;
+  for (int k = 1; k <= opt_.steps; ++k) {
+    const double w = (double)k / opt_.steps;
+    weights_[k - 1] = blendWeight(opt_.curve, w);
+    const int t = (int)std::lround(opt_.blend_time * w);
+    times_[k - 1] = t - prev_t; // 반올림 오차 누적 없이 합이 blend_time
+    prev_t = t;
+  }
+}
+
+std::vector<Frame> TransitionBuilder::build(const MotionEditor& from, const MotionEditor& to) const {
+  std::vector<Frame> out;
+  buildInto(from, to, out);
+  return out;
+}
+
+void TransitionBuilder::buildInto(const MotionEditor& from, const MotionEditor& to,
+                                  std::vector<Frame>& out) const {
+  if (from.frameCount() == 0 || to.frameCount() == 0) {
+    throw std::runtime_error("TransitionBuilder: both motions need at least one frame");
+  }
+  const Frame& a = from.frameAt(from.frameCount() - 1);
+  const Frame& b = to.frameAt(0);
+
+  // 관절 합집합 레이아웃: A 순서 + B에만 있는 관절
+  // start/end 는 관절당 시작·목표 값 (한쪽에만 있으면 둘이 같아 보간해도 상수)
+  thread_local std::vector<DxlValue> start, end;
+  start.assign(a.dxl.begin(), a.dxl.end());
+  end.assign(a.dxl.begin(), a.dxl.end());
+  const std::size_t na = a.dxl.size();
+  for (std::size_t i = 0; i < b.dxl.size(); ++i) {
+    const DxlValue& dv = b.dxl[i];
+    // 동일 레이아웃이면 같은 slot 에서 바로 일치, 아니면 선형 탐색
+    std::size_t k = i;
+    if (k >= na || start[k].id != dv.id) {
+      for (k = 0; k < na; ++k) if (start[k].id == dv.id) break;
+    }
+    if (k < na) {
+      end[k].position = dv.position;
+    } else {
+      start.push_back(dv);
+      end.push_back(dv);
+    }
+  }
+
+  const std::size_t J = start.size();
+  out.resize(opt_.steps);
+  for (int s = 0; s < opt_.steps; ++s) {
+    Frame& f = out[s];
+    f.time = times_[s];
+    f.delay = 0;
+    f.repeat = 0;
+    f.selected = false;
+    f.name = opt_.name_prefix + std::to_string(s);
+    f.dxl.resize(J);
+
+    const double w = weights_[s];
+    for (std::size_t j = 0; j < J; ++j) {
+      f.dxl[j].id = start[j].id;
+      f.dxl[j].position = start[j].position + w * (end[j].position - start[j].position);
+    }
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,59 @@
+/*
+ * Motion Transition
+ * @file motion_transition.hpp
+ * Generates crossfade frames between the last frame of one motion and the
+ * first frame of another, so motions can be chained without an abrupt jump.
+ *
+ * Key features:
+ * - Precomputed blend weights (linear / smoothstep / cosine / minimum-jerk)
+ * - Well-defined handling of joints present in only one motion
+ * - Output buffer reuse for on-the-fly generation at runtime
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+enum class BlendCurve {
+  Linear,
+  Smoothstep,    // 3w^2 - 2w^3
+  Cosine,        // (1 - cos(pi w)) / 2
+  MinimumJerk,   // 10w^3 - 15w^4 + 6w^5
+};
+
+struct TransitionOptions {
+  int blend_time{300};             // 전환 전체 시간 (Frame::time 단위)
+  int steps{10};                   // 생성할 중간 프레임 수 (마지막 프레임 = B의 첫 자세)
+  BlendCurve curve{BlendCurve::MinimumJerk};
+  std::string name_prefix{"blend_"};
+};
+
+// 모션 A -> B 전환 프레임 생성기
+//  - 양쪽에 있는 관절: A 마지막 값 -> B 첫 값으로 가중 보간
+//  - A에만 있는 관절: A 마지막 값 유지 (B 재생 중에는 명령되지 않으므로 현재 자세 그대로)
+//  - B에만 있는 관절: 시작 자세를 알 수 없으므로 B 첫 값 사용
+class TransitionBuilder {
+public:
+  explicit TransitionBuilder(const TransitionOptions& opt = TransitionOptions{});
+
+  // 새 벡터로 반환
+  std::vector<Frame> build(const MotionEditor& from, const MotionEditor& to) const;
+
+  // out 을 재사용해 할당 없이 생성 (런타임 반복 호출용)
+  void buildInto(const MotionEditor& from, const MotionEditor& to,
+                 std::vector<Frame>& out) const;
+
+  const std::vector<double>& weights() const { return weights_; }
+
+private:
+  TransitionOptions opt_;
+  std::vector<double> weights_;  // step k (1..steps) 의 B 가중치
+  std::vector<int> times_;       // step k 의 time (합 = blend_time)
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
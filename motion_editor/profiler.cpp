@@ -0,0 +1,134 @@
+/*
+ * Profiler
+ * @file profiler.cpp
+ * Global per-probe counters and a log-linear latency histogram
+ * (4 sub-buckets per power of two).
+ */
+
+#include "motion_editor/profiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace prof
+{
+namespace {
+constexpr std::size_t kProbeCount = (std::size_t)Probe::Count;
+constexpr std::size_t kBuckets = 256;
+
+const char* const kProbeNames[kProbeCount] = {
+  "load", "load.parse", "load.extract", "load.parse_frame", "load.scan", "load.lazy_dxl",
+  "save", "save.build", "save.emit",
+  "list_step_names", "get_frame",
+  "edit", "edit.lookup", "edit.update", "edit.selected",
+};
+
+struct ProbeCounters {
+  std::atomic<std::uint64_t> count{0};
+  std::atomic<std::uint64_t> total_ns{0};
+  std::atomic<std::uint64_t> max_ns{0};
+  std::array<std::atomic<std::uint64_t>, kBuckets> hist{};
+};
+
+ProbeCounters g_counters[kProbeCount];
+
+std::size_t bucketOf(std::uint64_t ns) {
+  if (ns < 4) return (std::size_t)ns;
+  const int msb = 63 - __builtin_clzll(ns);
+  const std::size_t sub = (std::size_t)(ns >> (msb - 2)) & 3;
+  return (std::size_t)(msb - 1) * 4 + sub;
+}
+
+// 버킷에 들어가는 최댓값
+std::uint64_t bucketUpper(std::size_t b) {
+  if (b < 4) return b;
+  const int msb = (int)(b / 4) + 1;
+  const std::uint64_t sub = b % 4;
+  const std::uint64_t width = std::uint64_t(1) << (msb - 2);
+  return ((4 + sub) << (msb - 2)) + width - 1;
+}
+
+std::uint64_t percentile(const std::array<std::uint64_t, kBuckets>& h, std::uint64_t count,
+                         double q, std::uint64_t max_ns) {
+  if (count == 0) return 0;
+  const std::uint64_t rank = std::max<std::uint64_t>(1, (std::uint64_t)std::ceil(q * (double)count));
+  std::uint64_t acc = 0;
+  for (std::size_t b = 0; b < kBuckets; ++b) {
+    acc += h[b];
+    if (acc >= rank) return std::min(bucketUpper(b), max_ns);
+  }
+  return max_ns;
+}
+} // namespace
+
+const char* probeName(Probe p) {
+  const auto i = (std::size_t)p;
+  return i < kProbeCount ? kProbeNames[i] : "?";
+}
+
+void record(Probe p, std::uint64_t ns) {
+  ProbeCounters& c = g_counters[(std::size_t)p];
+  c.count.fetch_add(1, std::memory_order_relaxed);
+  c.total_ns.fetch_add(ns, std::memory_order_relaxed);
+  c.hist[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+
+  std::uint64_t cur = c.max_ns.load(std::memory_order_relaxed);
+  while (ns > cur && !c.max_ns.compare_exchange_weak(cur, ns, std::memory_order_relaxed)) {}
+}
+
+std::vector<ProbeStats> snapshot() {
+  std::vector<ProbeStats> out;
+  out.reserve(kProbeCount);
+  for (std::size_t i = 0; i < kProbeCount; ++i) {
+    const ProbeCounters& c = g_counters[i];
+    // 기록 중인 값과 섞일 수 있으나 히스토그램 합을 count 로 써서 백분위는 항상 일관됨
+    std::array<std::uint64_t, kBuckets> h;
+    std::uint64_t n = 0;
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+      h[b] = c.hist[b].load(std::memory_order_relaxed);
+      n += h[b];
+    }
+    const std::uint64_t max_ns = c.max_ns.load(std::memory_order_relaxed);
+    out.push_back(ProbeStats{
+      kProbeNames[i],
+      c.count.load(std::memory_order_relaxed),
+      c.total_ns.load(std::memory_order_relaxed),
+      max_ns,
+      percentile(h, n, 0.50, max_ns),
+      percentile(h, n, 0.99, max_ns)});
+  }
+  return out;
+}
+
+void reset() {
+  for (auto& c : g_counters) {
+    c.count.store(0, std::memory_order_relaxed);
+    c.total_ns.store(0, std::memory_order_relaxed);
+    c.max_ns.store(0, std::memory_order_relaxed);
+    for (auto& b : c.hist) b.store(0, std::memory_order_relaxed);
+  }
+}
+
+void printStats(std::ostream& os) {
+  const auto flags = os.flags();
+  os << std::left << std::setw(18) << "probe" << std::right
+     << std::setw(10) << "count" << std::setw(14) << "total_us"
+     << std::setw(12) << "p50_us" << std::setw(12) << "p99_us" << std::setw(12) << "max_us" << "\n";
+  os << std::fixed << std::setprecision(2);
+  for (const auto& s : snapshot()) {
+    if (s.count == 0) continue;
+    os << std::left << std::setw(18) << s.name << std::right
+       << std::setw(10) << s.count
+       << std::setw(14) << s.total_ns / 1e3
+       << std::setw(12) << s.p50_ns / 1e3
+       << std::setw(12) << s.p99_ns / 1e3
+       << std::setw(12) << s.max_ns / 1e3 << "\n";
+  }
+  os.flags(flags);
+}
+
+} // namespace prof
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,101 @@
+/*
+ * Profiler
+ * @file profiler.hpp
+ * Scoped timers and counters for MotionEditor hot paths.
+ *
+ * Key features:
+ * - MOTION_EDITOR_PROFILE_SCOPE(probe) compiles to nothing unless
+ *   MOTION_EDITOR_ENABLE_PROFILING is defined (CMake option of the same name)
+ * - Lock-free recording: per-probe atomic count/total/max + log-scale histogram
+ * - snapshot() reports count, total, max, p50 and p99 per probe
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace prof
+{
+#ifdef MOTION_EDITOR_ENABLE_PROFILING
+inline constexpr bool kEnabled = true;
+#else
+inline constexpr bool kEnabled = false;
+#endif
+
+// 계측 지점 (probeName 과 순서 일치)
+enum class Probe : std::uint8_t {
+  Load,          // loadFromFile / loadFromString 전체
+  LoadParse,     //   YAML 텍스트 -> 노드
+  LoadExtract,   //   노드 -> 메타/프레임
+  ParseFrame,    //     parseFrameFromNode (프레임 1개)
+  LoadScan,      //   지연 로드: 텍스트 -> 메타/프레임 헤더 색인
+  LoadDxl,       //   지연 프레임 dxl 블록 파싱 (첫 접근 시, 프레임 1개)
+  Save,          // saveToFile 전체
+  SaveBuild,     //   buildYamlFromAll
+  SaveEmit,      //   노드 -> 파일 출력
+  ListStepNames, // listStepNames / listStepNameViews
+  GetFrame,
+  EditJoints,    // editJoints / editFourArmJoints / editJointIds 전체
+  EditLookup,    //   스텝 이름 -> 프레임 인덱스
+  EditUpdate,    //   COW 분리 + 관절 값 반영
+  EditSelected,  // editSelectedJoints / setSelectedTiming (선택 프레임 일괄)
+  Count
+};
+
+const char* probeName(Probe p);
+
+struct ProbeStats {
+  const char* name;
+  std::uint64_t count;
+  std::uint64_t total_ns;
+  std::uint64_t max_ns;
+  std::uint64_t p50_ns;  // 히스토그램 추정값 (버킷 상대 오차 < 25%)
+  std::uint64_t p99_ns;
+};
+
+// 기록 (여러 스레드에서 동시에 호출 가능)
+void record(Probe p, std::uint64_t ns);
+
+// 현재 누적 통계 (Probe 순서), 비활성 빌드에서는 전부 0
+std::vector<ProbeStats> snapshot();
+void reset();
+
+// 사람이 읽는 표 (호출 0회 항목은 생략)
+void printStats(std::ostream& os);
+
+class ScopedTimer {
+public:
+  explicit ScopedTimer(Probe p)
+  : probe_(p), start_(std::chrono::steady_clock::now()) {}
+  ~ScopedTimer() {
+    const auto d = std::chrono::steady_clock::now() - start_;
+    record(probe_, (std::uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+  }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+  Probe probe_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace prof
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
+
+#define MOTION_EDITOR_PROF_CAT2(a, b) a##b
+#define MOTION_EDITOR_PROF_CAT(a, b) MOTION_EDITOR_PROF_CAT2(a, b)
+
+#ifdef MOTION_EDITOR_ENABLE_PROFILING
+#define MOTION_EDITOR_PROFILE_SCOPE(probe)                                          \
+  ::ROBIT_HUMANOID_MOTION_EDITOR::prof::ScopedTimer MOTION_EDITOR_PROF_CAT(         \
+    motion_editor_prof_scope_, __LINE__)(::ROBIT_HUMANOID_MOTION_EDITOR::prof::Probe::probe)
+#else
+#define MOTION_EDITOR_PROFILE_SCOPE(probe) ((void)0)
+#endif
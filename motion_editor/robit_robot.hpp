@@ -0,0 +1,33 @@
+/*
+ * ROBIT humanoid joint table
+ * @file robit_robot.hpp
+ * Compile-time joint description of the default robot used by MotionEditor().
+ * Edit this table (not MotionEditor) when the default mapping changes.
+ */
+
+#pragma once
+
+#include "motion_editor/robot_description.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace robit
+{
+// 기본 매핑  >> 수정해서 사용할 것
+inline constexpr JointSpec kJoints[] = {
+  {"rotate_torso", 22},
+  {"rotate_0",      0},
+  {"rotate_1",      1},
+  {"rotate_2",      2},
+  {"rotate_3",      3},
+  {"rotate_5",      5},
+};
+
+inline constexpr auto kRobot = makeRobotDescription(kJoints);
+
+// editFourArmJoints 가 다루는 관절 그룹
+inline constexpr auto kArmGroup = kRobot.group({
+  "rotate_torso", "rotate_0", "rotate_1", "rotate_2", "rotate_3", "rotate_5"});
+
+} // namespace robit
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,173 @@
+/*
+ * Robot Description
+ * @file robot_description.hpp
+ * Compile-time robot joint tables.
+ *
+ * Key features:
+ * - constexpr joint table (name, motor id)
+ * - Perfect hash for name -> id, seed searched at compile time
+ * - Dense id -> slot array
+ * - Typed joint-group constants resolved at compile time
+ * - Non-template JointTableView for runtime use inside MotionEditor
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct JointSpec {
+  std::string_view name;
+  int id;
+};
+
+// Dynamixel 프로토콜 ID 범위 (0..252) 를 덮는 dense 테이블 크기
+constexpr int kMaxMotorId = 255;
+
+// 시드 섞은 FNV-1a (컴파일 타임/런타임 공용)
+constexpr std::uint32_t jointNameHash(std::string_view s, std::uint32_t seed) {
+  std::uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+  for (char c : s) {
+    h ^= static_cast<std::uint8_t>(c);
+    h *= 16777619u;
+  }
+  h ^= h >> 15;
+  return h;
+}
+
+// 런타임 조회용 비템플릿 뷰 (정적 수명의 RobotDescription 을 가리킴)
+struct JointTableView {
+  const JointSpec* joints{nullptr};
+  std::size_t count{0};
+  const std::uint8_t* buckets{nullptr}; // 해시 버킷 -> slot+1 (0 = 비어 있음)
+  std::uint32_t mask{0};
+  std::uint32_t seed{0};
+  const std::int16_t* id_to_slot{nullptr};
+
+  explicit operator bool() const { return joints != nullptr; }
+
+  // 이름 -> 모터ID (없으면 -1): 해시 1회 + 문자열 비교 1회
+  constexpr int id(std::string_view name) const {
+    const std::uint8_t b = buckets[jointNameHash(name, seed) & mask];
+    if (b == 0) return -1;
+    const JointSpec& j = joints[b - 1];
+    return j.name == name ? j.id : -1;
+  }
+
+  // 모터ID -> slot (없으면 -1)
+  constexpr int slot(int motor_id) const {
+    return (motor_id >= 0 && motor_id <= kMaxMotorId) ? id_to_slot[motor_id] : -1;
+  }
+};
+
+// 컴파일 타임 관절 그룹 (관절명/모터ID/slot 이 모두 상수)
+template <std::size_t K>
+struct JointGroup {
+  std::array<std::string_view, K> names{};
+  std::array<int, K> ids{};
+  std::array<int, K> slots{};
+
+  static constexpr std::size_t size() { return K; }
+
+  constexpr bool contains(std::string_view name) const {
+    for (std::size_t k = 0; k < K; ++k) if (names[k] == name) return true;
+    return false;
+  }
+  constexpr bool containsId(int motor_id) const {
+    for (std::size_t k = 0; k < K; ++k) if (ids[k] == motor_id) return true;
+    return false;
+  }
+};
+
+template <std::size_t N>
+class RobotDescription {
+  static_assert(N > 0 && N < 255, "RobotDescription: joint count must fit in 8-bit slots");
+
+public:
+  // 버킷 수: 4N 이상 2의 거듭제곱 (충돌 없는 시드를 빨리 찾도록 여유 있게)
+  static constexpr std::size_t kBuckets = [] {
+    std::size_t m = 1;
+    while (m < 4 * N) m <<= 1;
+    return m;
+  }();
+
+  constexpr explicit RobotDescription(const JointSpec (&joints)[N]) {
+    for (std::size_t i = 0; i < N; ++i) {
+      joints_[i] = joints[i];
+      if (joints[i].id < 0 || joints[i].id > kMaxMotorId) throw std::logic_error("motor id out of range");
+    }
+    for (auto& s : id_to_slot_) s = -1;
+    for (std::size_t i = 0; i < N; ++i) {
+      if (id_to_slot_[joints_[i].id] != -1) throw std::logic_error("duplicate motor id");
+      id_to_slot_[joints_[i].id] = static_cast<std::int16_t>(i);
+    }
+
+    // 충돌 없는 시드 탐색 (컴파일 타임에 수행됨)
+    for (std::uint32_t seed = 1;; ++seed) {
+      std::array<std::uint8_t, kBuckets> b{};
+      bool ok = true;
+      for (std::size_t i = 0; i < N && ok; ++i) {
+        auto& cell = b[jointNameHash(joints_[i].name, seed) & (kBuckets - 1)];
+        if (cell != 0) ok = false;
+        else cell = static_cast<std::uint8_t>(i + 1);
+      }
+      if (ok) {
+        // 동일 이름이 두 번 있으면 위에서 반드시 충돌하므로 여기까지 오지 않음
+        buckets_ = b;
+        seed_ = seed;
+        break;
+      }
+      if (seed > 100000) throw std::logic_error("no perfect hash seed (duplicate joint name?)");
+    }
+  }
+
+  static constexpr std::size_t size() { return N; }
+  constexpr const JointSpec& joint(std::size_t slot) const { return joints_[slot]; }
+
+  constexpr int id(std::string_view name) const {
+    const std::uint8_t b = buckets_[jointNameHash(name, seed_) & (kBuckets - 1)];
+    if (b == 0) return -1;
+    return joints_[b - 1].name == name ? joints_[b - 1].id : -1;
+  }
+
+  constexpr int slot(int motor_id) const {
+    return (motor_id >= 0 && motor_id <= kMaxMotorId) ? id_to_slot_[motor_id] : -1;
+  }
+
+  // 이름 목록으로 그룹 상수 생성 (모르는 이름이면 컴파일 에러)
+  template <std::size_t K>
+  constexpr JointGroup<K> group(const std::string_view (&names)[K]) const {
+    JointGroup<K> g{};
+    for (std::size_t k = 0; k < K; ++k) {
+      const int motor_id = id(names[k]);
+      if (motor_id < 0) throw std::logic_error("unknown joint in group");
+      g.names[k] = names[k];
+      g.ids[k] = motor_id;
+      g.slots[k] = slot(motor_id);
+    }
+    return g;
+  }
+
+  // 정적 수명 객체에서만 사용할 것 (inline constexpr 변수 등)
+  JointTableView view() const {
+    return JointTableView{joints_.data(), N, buckets_.data(), (std::uint32_t)(kBuckets - 1),
+                          seed_, id_to_slot_.data()};
+  }
+
+private:
+  std::array<JointSpec, N> joints_{};
+  std::array<std::uint8_t, kBuckets> buckets_{};
+  std::array<std::int16_t, kMaxMotorId + 1> id_to_slot_{};
+  std::uint32_t seed_{0};
+};
+
+template <std::size_t N>
+constexpr RobotDescription<N> makeRobotDescription(const JointSpec (&joints)[N]) {
+  return RobotDescription<N>(joints);
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
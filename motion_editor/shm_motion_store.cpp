@@ -0,0 +1,345 @@
+/*
+ * Shared-Memory Motion Store
+ * @file shm_motion_store.cpp
+ * Publisher: size everything first, write the whole data segment through a
+ * private mapping, then release-store the new generation in the control segment.
+ * Client: acquire-load the generation, open that data segment read-only and
+ * validate its header; if it was already replaced and unlinked, retry.
+ */
+
+#include "motion_editor/shm_motion_store.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace shm {
+
+struct Mapping {
+  const std::uint8_t* base{nullptr};
+  std::size_t size{0};
+
+  ~Mapping() {
+    if (base) ::munmap(const_cast<std::uint8_t*>(base), size);
+  }
+  const Header& header() const { return *reinterpret_cast<const Header*>(base); }
+};
+
+} // namespace shm
+
+namespace {
+constexpr int kOpenRetries = 16; // 여는 사이 다음 버전으로 교체된 경우
+
+void checkName(const std::string& name) {
+  if (name.size() < 2 || name[0] != '/' || name.find('/', 1) != std::string::npos) {
+    throw std::runtime_error("ShmMotionStore: invalid segment name (expected \"/name\"): " + name);
+  }
+}
+
+std::string dataName(const std::string& name, std::uint64_t gen) {
+  return name + "." + std::to_string(gen);
+}
+
+std::size_t align8(std::size_t v) { return (v + 7) & ~std::size_t(7); }
+
+std::string errnoText() { return std::strerror(errno); }
+} // namespace
+
+// ===== 발행 =====
+
+ShmMotionPublisher::ShmMotionPublisher(const std::string& name)
+: name_(name) {
+  checkName(name_);
+  const int fd = ::shm_open(name_.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+  if (fd < 0) throw std::runtime_error("ShmMotionPublisher: cannot open " + name_ + ": " + errnoText());
+  if (::ftruncate(fd, sizeof(shm::Control)) != 0) {
+    const std::string err = errnoText();
+    ::close(fd);
+    throw std::runtime_error("ShmMotionPublisher: cannot size " + name_ + ": " + err);
+  }
+  void* p = ::mmap(nullptr, sizeof(shm::Control), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED) throw std::runtime_error("ShmMotionPublisher: mmap failed: " + name_);
+
+  if (std::memcmp(p, shm::kControlMagic, sizeof shm::kControlMagic) == 0) {
+    control_ = static_cast<shm::Control*>(p);
+    generation_ = control_->generation.load(std::memory_order_acquire);
+  } else {
+    // 새 세그먼트 (0 으로 채워져 있음)
+    control_ = new (p) shm::Control{};
+    control_->generation.store(0, std::memory_order_relaxed);
+    std::memcpy(control_->magic, shm::kControlMagic, sizeof shm::kControlMagic);
+  }
+}
+
+ShmMotionPublisher::~ShmMotionPublisher() {
+  if (generation_) ::shm_unlink(dataName(name_, generation_).c_str());
+  ::shm_unlink(name_.c_str());
+  ::munmap(control_, sizeof(shm::Control));
+}
+
+ShmPublishStats ShmMotionPublisher::publish(const MotionLibrary& lib) {
+  std::vector<std::pair<std::string, std::shared_ptr<const MotionEditor>>> motions;
+  for (const auto& name : lib.names()) {
+    if (auto m = lib.get(name)) motions.emplace_back(name, std::move(m)); // 그사이 제거된 모션은 건너뜀
+  }
+  return publish(motions);
+}
+
+ShmPublishStats ShmMotionPublisher::publish(
+  const std::vector<std::pair<std::string, std::shared_ptr<const MotionEditor>>>& motions) {
+  // 이름순 (클라이언트 이진 탐색)
+  std::vector<const std::pair<std::string, std::shared_ptr<const MotionEditor>>*> order;
+  for (const auto& m : motions) {
+    if (!m.second) throw std::runtime_error("ShmMotionPublisher: null motion: " + m.first);
+    order.push_back(&m);
+  }
+  std::sort(order.begin(), order.end(), [](auto* a, auto* b) { return a->first < b->first; });
+  for (std::size_t k = 1; k < order.size(); ++k) {
+    if (order[k]->first == order[k - 1]->first) {
+      throw std::runtime_error("ShmMotionPublisher: duplicate motion: " + order[k]->first);
+    }
+  }
+
+  // 1) 크기 계산
+  std::size_t frames = 0, dxl = 0, ids = 0, strings = 0;
+  for (auto* m : order) {
+    const MotionEditor& me = *m->second;
+    frames += me.frameCount();
+    ids += me.motorIds().size();
+    strings += m->first.size() + me.motionName().size();
+    for (std::size_t i = 0; i < me.frameCount(); ++i) {
+      const Frame& f = me.frameAt(i);
+      dxl += f.dxl.size();
+      strings += f.name.size();
+    }
+  }
+  const std::size_t motions_off = align8(sizeof(shm::Header));
+  const std::size_t frames_off = motions_off + order.size() * sizeof(shm::MotionRec);
+  const std::size_t dxl_off = frames_off + frames * sizeof(shm::FrameRec);
+  const std::size_t ids_off = dxl_off + dxl * sizeof(shm::DxlRec);
+  const std::size_t str_off = ids_off + ids * sizeof(std::int32_t);
+  const std::size_t size = std::max<std::size_t>(align8(str_off + strings), 8);
+
+  // 2) 데이터 세그먼트 생성
+  const std::uint64_t gen = generation_ + 1;
+  const std::string data = dataName(name_, gen);
+  int fd = ::shm_open(data.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+  if (fd < 0 && errno == EEXIST) {
+    // 비정상 종료한 발행자가 남긴 같은 이름
+    ::shm_unlink(data.c_str());
+    fd = ::shm_open(data.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0644);
+  }
+  if (fd < 0) throw std::runtime_error("ShmMotionPublisher: cannot create " + data + ": " + errnoText());
+  if (::ftruncate(fd, (off_t)size) != 0) {
+    const std::string err = errnoText();
+    ::close(fd);
+    ::shm_unlink(data.c_str());
+    throw std::runtime_error("ShmMotionPublisher: cannot size " + data + ": " + err);
+  }
+  void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED) {
+    ::shm_unlink(data.c_str());
+    throw std::runtime_error("ShmMotionPublisher: mmap failed: " + data);
+  }
+  auto* base = static_cast<std::uint8_t*>(p);
+
+  // 3) 기록 (ftruncate 로 0 채워진 상태, 패딩은 그대로 0)
+  auto* mrec = reinterpret_cast<shm::MotionRec*>(base + motions_off);
+  auto* frec = reinterpret_cast<shm::FrameRec*>(base + frames_off);
+  auto* drec = reinterpret_cast<shm::DxlRec*>(base + dxl_off);
+  auto* idrec = reinterpret_cast<std::int32_t*>(base + ids_off);
+  std::size_t fi = 0, di = 0, ii = 0, so = str_off;
+  auto putStr = [&](std::string_view s) {
+    std::memcpy(base + so, s.data(), s.size());
+    const std::uint64_t off = so;
+    so += s.size();
+    return off;
+  };
+
+  for (std::size_t k = 0; k < order.size(); ++k) {
+    const std::string& lname = order[k]->first;
+    const MotionEditor& me = *order[k]->second;
+    shm::MotionRec& r = mrec[k];
+    r.name_off = putStr(lname);
+    r.name_len = (std::uint32_t)lname.size();
+    r.motion_name_off = putStr(me.motionName());
+    r.motion_name_len = (std::uint32_t)me.motionName().size();
+    r.frames_off = frames_off + fi * sizeof(shm::FrameRec);
+    r.frame_count = (std::uint32_t)me.frameCount();
+    r.motor_ids_off = ids_off + ii * sizeof(std::int32_t);
+    r.motor_id_count = (std::uint32_t)me.motorIds().size();
+    for (int id : me.motorIds()) idrec[ii++] = id;
+
+    for (std::size_t i = 0; i < me.frameCount(); ++i, ++fi) {
+      const Frame& f = me.frameAt(i);
+      shm::FrameRec& fr = frec[fi];
+      fr.time = f.time;
+      fr.delay = f.delay;
+      fr.repeat = f.repeat;
+      fr.selected = me.isSelected(i) ? 1 : 0;
+      fr.name_off = putStr(f.name);
+      fr.name_len = (std::uint32_t)f.name.size();
+      fr.dxl_off = dxl_off + di * sizeof(shm::DxlRec);
+      fr.dxl_count = (std::uint32_t)f.dxl.size();
+      for (const auto& dv : f.dxl) {
+        drec[di].id = dv.id;
+        drec[di].position = dv.position;
+        ++di;
+      }
+    }
+  }
+
+  auto* h = reinterpret_cast<shm::Header*>(base);
+  h->generation = gen;
+  h->size = size;
+  h->motion_count = (std::uint32_t)order.size();
+  h->motions_off = motions_off;
+  std::memcpy(h->magic, shm::kDataMagic, sizeof shm::kDataMagic);
+  ::munmap(p, size);
+
+  // 4) 교체: 새 세대를 알린 뒤 이전 이름 제거 (매핑 중인 프로세스는 영향 없음)
+  control_->generation.store(gen, std::memory_order_release);
+  if (generation_) ::shm_unlink(dataName(name_, generation_).c_str());
+  generation_ = gen;
+
+  return ShmPublishStats{gen, order.size(), frames, size};
+}
+
+// ===== 읽기 =====
+
+ShmMotion::ShmMotion(std::shared_ptr<const shm::Mapping> map, const shm::MotionRec* rec)
+: map_(std::move(map)), base_(map_->base), rec_(rec),
+  frames_(reinterpret_cast<const shm::FrameRec*>(base_ + rec->frames_off)) {}
+
+long ShmMotion::find(std::string_view step_name) const {
+  for (std::size_t i = 0; i < size(); ++i) {
+    if (str(frames_[i].name_off, frames_[i].name_len) == step_name) return (long)i;
+  }
+  return -1;
+}
+
+void ShmMotion::copyTo(MotionEditor& me) const {
+  me.clearFrames();
+  if (!motionName().empty()) me.setMotionName(std::string(motionName()));
+  std::vector<int> ids(motorIdCount());
+  for (std::size_t k = 0; k < ids.size(); ++k) ids[k] = motorId(k);
+  if (!ids.empty()) me.setMotorIds(ids);
+  for (std::size_t i = 0; i < size(); ++i) {
+    const FrameView fv = (*this)[i];
+    Frame f;
+    f.time = fv.time;
+    f.delay = fv.delay;
+    f.repeat = fv.repeat;
+    f.selected = fv.selected;
+    f.name = std::string(fv.name);
+    f.dxl.reserve(fv.dxl.size());
+    for (const auto& d : fv.dxl) f.dxl.push_back(DxlValue{d.id, d.position});
+    me.appendFrame(std::move(f));
+  }
+}
+
+ShmMotionStore::ShmMotionStore(const std::string& name)
+: name_(name) {
+  checkName(name_);
+  const int fd = ::shm_open(name_.c_str(), O_RDONLY | O_CLOEXEC, 0);
+  if (fd < 0) throw std::runtime_error("ShmMotionStore: cannot open " + name_ + ": " + errnoText());
+  struct stat st;
+  if (::fstat(fd, &st) != 0 || (std::size_t)st.st_size < sizeof(shm::Control)) {
+    ::close(fd);
+    throw std::runtime_error("ShmMotionStore: not a motion store: " + name_);
+  }
+  void* p = ::mmap(nullptr, sizeof(shm::Control), PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (p == MAP_FAILED) throw std::runtime_error("ShmMotionStore: mmap failed: " + name_);
+  control_ = static_cast<const shm::Control*>(p);
+  if (std::memcmp(control_->magic, shm::kControlMagic, sizeof shm::kControlMagic) != 0) {
+    ::munmap(p, sizeof(shm::Control));
+    throw std::runtime_error("ShmMotionStore: not a motion store: " + name_);
+  }
+  if (!refresh()) {
+    ::munmap(p, sizeof(shm::Control));
+    throw std::runtime_error("ShmMotionStore: nothing published yet: " + name_);
+  }
+}
+
+ShmMotionStore::~ShmMotionStore() {
+  ::munmap(const_cast<shm::Control*>(control_), sizeof(shm::Control));
+}
+
+bool ShmMotionStore::refresh() {
+  for (int attempt = 0; attempt < kOpenRetries; ++attempt) {
+    const std::uint64_t gen = control_->generation.load(std::memory_order_acquire);
+    if (gen == 0 || (map_ && map_->header().generation == gen)) return false;
+
+    const int fd = ::shm_open(dataName(name_, gen).c_str(), O_RDONLY | O_CLOEXEC, 0);
+    if (fd < 0) {
+      if (errno == ENOENT) continue; // 그사이 다음 버전으로 교체됨
+      throw std::runtime_error("ShmMotionStore: cannot open " + dataName(name_, gen) + ": " + errnoText());
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || (std::size_t)st.st_size < sizeof(shm::Header)) {
+      ::close(fd);
+      throw std::runtime_error("ShmMotionStore: truncated segment: " + dataName(name_, gen));
+    }
+    void* p = ::mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) throw std::runtime_error("ShmMotionStore: mmap failed: " + dataName(name_, gen));
+
+    auto m = std::make_shared<shm::Mapping>();
+    m->base = static_cast<const std::uint8_t*>(p);
+    m->size = (std::size_t)st.st_size;
+    const shm::Header& h = m->header();
+    if (std::memcmp(h.magic, shm::kDataMagic, sizeof shm::kDataMagic) != 0 || h.generation != gen ||
+        h.size != m->size) {
+      throw std::runtime_error("ShmMotionStore: corrupt segment: " + dataName(name_, gen));
+    }
+    map_ = std::move(m);
+    return true;
+  }
+  throw std::runtime_error("ShmMotionStore: publisher keeps replacing " + name_);
+}
+
+std::uint64_t ShmMotionStore::generation() const {
+  return map_->header().generation;
+}
+
+std::size_t ShmMotionStore::size() const {
+  return map_->header().motion_count;
+}
+
+std::vector<std::string_view> ShmMotionStore::names() const {
+  std::vector<std::string_view> out;
+  out.reserve(size());
+  for (std::size_t k = 0; k < size(); ++k) out.push_back(motion(k).name());
+  return out;
+}
+
+ShmMotion ShmMotionStore::motion(std::size_t i) const {
+  if (i >= size()) throw std::runtime_error("ShmMotionStore: motion index out of range");
+  const auto* recs = reinterpret_cast<const shm::MotionRec*>(map_->base + map_->header().motions_off);
+  return ShmMotion(map_, recs + i);
+}
+
+std::optional<ShmMotion> ShmMotionStore::find(std::string_view name) const {
+  const auto* recs = reinterpret_cast<const shm::MotionRec*>(map_->base + map_->header().motions_off);
+  const auto* end = recs + size();
+  const auto* it = std::lower_bound(recs, end, name, [&](const shm::MotionRec& r, std::string_view n) {
+    return std::string_view(reinterpret_cast<const char*>(map_->base + r.name_off), r.name_len) < n;
+  });
+  if (it == end || std::string_view(reinterpret_cast<const char*>(map_->base + it->name_off), it->name_len) != name) {
+    return std::nullopt;
+  }
+  return ShmMotion(map_, it);
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,212 @@
+/*
+ * Shared-Memory Motion Store
+ * @file shm_motion_store.hpp
+ * One process publishes the parsed library into POSIX shared memory; playback,
+ * visualization and logging processes map it read-only and read frames in
+ * place instead of each loading the YAML into their own heap.
+ *
+ * Segments (name = "/something", no other '/'):
+ *   <name>          control: magic + atomic generation of the current data segment
+ *   <name>.<gen>    data: immutable once published, written in full before the
+ *                   control generation is bumped; the previous data segment is
+ *                   unlinked, so processes still mapping it keep reading it
+ *
+ * Data layout (pointer-free, every *_off is a byte offset from the segment start):
+ *   Header | MotionRec[motions] (sorted by name) | FrameRec[all frames] |
+ *   DxlRec[all dxl] | i32 motor ids | strings
+ *
+ * Key features:
+ * - Zero-copy: frame names are string_views and dxl rows point into the mapping
+ * - refresh() picks up a republished version atomically; views taken before
+ *   keep the old mapping alive until they are dropped
+ * - ShmMotion satisfies the Source requirements of motion_sampler.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+#include "motion_editor/motion_library.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+namespace shm {
+
+constexpr char kControlMagic[8] = {'M', 'E', 'S', 'H', 'C', 'T', 'L', '1'};
+constexpr char kDataMagic[8] = {'M', 'E', 'S', 'H', 'D', 'A', 'T', '1'};
+
+struct Control {
+  char magic[8];
+  std::atomic<std::uint64_t> generation; // 현재 데이터 세그먼트 (0 = 아직 발행 없음)
+};
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared-memory generation must be lock-free");
+
+struct Header {
+  char magic[8];
+  std::uint64_t generation;
+  std::uint64_t size;          // 세그먼트 전체 바이트
+  std::uint32_t motion_count;
+  std::uint32_t reserved;
+  std::uint64_t motions_off;
+};
+
+struct MotionRec {
+  std::uint64_t name_off;      // 라이브러리 이름 (파일 stem)
+  std::uint64_t motion_name_off; // 메타 name
+  std::uint64_t frames_off;
+  std::uint64_t motor_ids_off;
+  std::uint32_t name_len;
+  std::uint32_t motion_name_len;
+  std::uint32_t frame_count;
+  std::uint32_t motor_id_count;
+};
+
+struct FrameRec {
+  std::int32_t time;
+  std::int32_t delay;
+  std::int32_t repeat;
+  std::uint32_t name_len;
+  std::uint64_t name_off;
+  std::uint64_t dxl_off;
+  std::uint32_t dxl_count;
+  std::uint8_t selected;
+  std::uint8_t pad[3];
+};
+
+struct DxlRec {
+  std::int32_t id;
+  std::uint32_t pad;
+  double position; // rad
+};
+
+static_assert(std::is_trivially_copyable_v<Header> && std::is_trivially_copyable_v<MotionRec> &&
+              std::is_trivially_copyable_v<FrameRec> && std::is_trivially_copyable_v<DxlRec>,
+              "shared-memory records must be trivially copyable");
+static_assert(sizeof(FrameRec) == 40 && sizeof(DxlRec) == 16 && sizeof(MotionRec) == 48,
+              "shared-memory record layout changed");
+
+struct Mapping; // 읽기 전용 매핑 (shm_motion_store.cpp)
+
+} // namespace shm
+
+struct ShmPublishStats {
+  std::uint64_t generation{0};
+  std::size_t motions{0};
+  std::size_t frames{0};
+  std::size_t bytes{0}; // 데이터 세그먼트 크기
+};
+
+class ShmMotionPublisher {
+public:
+  // 제어 세그먼트를 만들거나 열고, 이전 발행자의 generation 다음부터 이어서 발행
+  explicit ShmMotionPublisher(const std::string& name);
+  // 세그먼트 이름을 모두 제거 (이미 매핑한 클라이언트는 마지막 버전을 계속 읽음)
+  ~ShmMotionPublisher();
+
+  ShmMotionPublisher(const ShmMotionPublisher&) = delete;
+  ShmMotionPublisher& operator=(const ShmMotionPublisher&) = delete;
+
+  // 라이브러리 전체 (호출 시점 스냅샷)
+  ShmPublishStats publish(const MotionLibrary& lib);
+  // (모션 이름, 모션) 목록, 이름 중복이면 예외
+  ShmPublishStats publish(const std::vector<std::pair<std::string, std::shared_ptr<const MotionEditor>>>& motions);
+
+  std::uint64_t generation() const { return generation_; }
+
+private:
+  std::string name_;
+  shm::Control* control_{nullptr};
+  std::uint64_t generation_{0};
+};
+
+// 모션 하나에 대한 읽기 전용 뷰 (매핑 수명을 공유하므로 refresh 후에도 유효)
+class ShmMotion {
+public:
+  // 프레임 한 행 (Frame::dxl 과 같은 방식으로 인덱싱)
+  struct DxlRow {
+    const shm::DxlRec* p;
+    std::size_t n;
+
+    std::size_t size() const { return n; }
+    const shm::DxlRec& operator[](std::size_t k) const { return p[k]; }
+    const shm::DxlRec* begin() const { return p; }
+    const shm::DxlRec* end() const { return p + n; }
+  };
+
+  struct FrameView {
+    int time;
+    int delay;
+    int repeat;
+    bool selected;
+    std::string_view name;
+    DxlRow dxl;
+  };
+
+  std::string_view name() const { return str(rec_->name_off, rec_->name_len); }
+  std::string_view motionName() const { return str(rec_->motion_name_off, rec_->motion_name_len); }
+  std::size_t size() const { return rec_->frame_count; }
+
+  FrameView operator[](std::size_t i) const {
+    const shm::FrameRec& f = frames_[i];
+    return FrameView{f.time, f.delay, f.repeat, f.selected != 0, str(f.name_off, f.name_len),
+                     DxlRow{reinterpret_cast<const shm::DxlRec*>(base_ + f.dxl_off), f.dxl_count}};
+  }
+
+  // 메타 motor id 목록
+  std::size_t motorIdCount() const { return rec_->motor_id_count; }
+  int motorId(std::size_t k) const { return reinterpret_cast<const std::int32_t*>(base_ + rec_->motor_ids_off)[k]; }
+
+  // 이름으로 첫 프레임 인덱스 (없으면 -1)
+  long find(std::string_view step_name) const;
+
+  // 힙 편집기로 복사 (편집이 필요할 때만)
+  void copyTo(MotionEditor& me) const;
+
+private:
+  friend class ShmMotionStore;
+  ShmMotion(std::shared_ptr<const shm::Mapping> map, const shm::MotionRec* rec);
+
+  std::string_view str(std::uint64_t off, std::uint32_t len) const {
+    return std::string_view(reinterpret_cast<const char*>(base_ + off), len);
+  }
+
+  std::shared_ptr<const shm::Mapping> map_;
+  const std::uint8_t* base_;
+  const shm::MotionRec* rec_;
+  const shm::FrameRec* frames_;
+};
+
+class ShmMotionStore {
+public:
+  // 아직 발행된 적이 없거나 형식이 다르면 예외
+  explicit ShmMotionStore(const std::string& name);
+  ~ShmMotionStore();
+
+  ShmMotionStore(const ShmMotionStore&) = delete;
+  ShmMotionStore& operator=(const ShmMotionStore&) = delete;
+
+  // 새 버전이 발행됐으면 다시 매핑, 반환: 바뀌었는지
+  bool refresh();
+
+  std::uint64_t generation() const;
+  std::size_t size() const;
+  std::vector<std::string_view> names() const; // 다음 refresh 전까지 유효
+  ShmMotion motion(std::size_t i) const;
+  std::optional<ShmMotion> find(std::string_view name) const;
+
+private:
+  std::string name_;
+  const shm::Control* control_{nullptr};
+  std::shared_ptr<const shm::Mapping> map_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
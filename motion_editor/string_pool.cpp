@@ -0,0 +1,72 @@
+/*
+ * String Pool
+ * @file string_pool.cpp
+ * Interning pool that maps frame / joint names to 32-bit symbols.
+ */
+
+#include "motion_editor/string_pool.hpp"
+
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+Symbol StringPool::intern(std::string_view s) {
+  {
+    std::shared_lock<std::shared_mutex> lk(mu_);
+    auto it = index_.find(s);
+    if (it != index_.end()) return Symbol{it->second};
+  }
+
+  std::unique_lock<std::shared_mutex> lk(mu_);
+  auto it = index_.find(s); // 락 사이에 다른 스레드가 추가했을 수 있음
+  if (it != index_.end()) return Symbol{it->second};
+
+  if (views_.size() >= Symbol::kInvalid) throw std::runtime_error("StringPool: symbol space exhausted");
+  const std::string_view stored = store(s);
+  const auto id = (std::uint32_t)views_.size();
+  views_.push_back(stored);
+  index_.emplace(stored, id);
+  return Symbol{id};
+}
+
+std::optional<Symbol> StringPool::find(std::string_view s) const {
+  std::shared_lock<std::shared_mutex> lk(mu_);
+  auto it = index_.find(s);
+  if (it == index_.end()) return std::nullopt;
+  return Symbol{it->second};
+}
+
+std::string_view StringPool::view(Symbol sym) const {
+  std::shared_lock<std::shared_mutex> lk(mu_);
+  if (sym.id >= views_.size()) return {};
+  return views_[sym.id];
+}
+
+std::size_t StringPool::size() const {
+  std::shared_lock<std::shared_mutex> lk(mu_);
+  return views_.size();
+}
+
+std::string_view StringPool::store(std::string_view s) {
+  if (s.empty()) return std::string_view();
+
+  // 블록보다 큰 문자열은 전용 블록
+  if (s.size() > kBlockSize) {
+    blocks_.push_back(std::make_unique<char[]>(s.size()));
+    std::memcpy(blocks_.back().get(), s.data(), s.size());
+    return std::string_view(blocks_.back().get(), s.size());
+  }
+  if (!cur_block_ || block_used_ + s.size() > kBlockSize) {
+    blocks_.push_back(std::make_unique<char[]>(kBlockSize));
+    cur_block_ = blocks_.back().get();
+    block_used_ = 0;
+  }
+  char* dst = cur_block_ + block_used_;
+  std::memcpy(dst, s.data(), s.size());
+  block_used_ += s.size();
+  return std::string_view(dst, s.size());
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,72 @@
+/*
+ * String Pool
+ * @file string_pool.hpp
+ * Interning pool that maps frame / joint names to 32-bit symbols.
+ *
+ * Key features:
+ * - O(1) equality and hashing on Symbol (plain integer compare)
+ * - Stable string_view storage for the pool's lifetime
+ * - Thread-safe; meant to be shared by every motion of a library
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+struct Symbol {
+  static constexpr std::uint32_t kInvalid = 0xFFFFFFFFu;
+  std::uint32_t id{kInvalid};
+
+  bool valid() const { return id != kInvalid; }
+  bool operator==(const Symbol& o) const { return id == o.id; }
+  bool operator!=(const Symbol& o) const { return id != o.id; }
+};
+
+class StringPool {
+public:
+  StringPool() = default;
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+
+  // 없으면 추가 후 심볼 반환
+  Symbol intern(std::string_view s);
+
+  // 추가 없이 조회 (없으면 std::nullopt)
+  std::optional<Symbol> find(std::string_view s) const;
+
+  // 심볼 -> 문자열 (풀이 살아 있는 동안 유효)
+  std::string_view view(Symbol sym) const;
+
+  std::size_t size() const;
+
+private:
+  static constexpr std::size_t kBlockSize = 64 * 1024;
+
+  // 문자 저장 블록: 한 번 기록되면 이동하지 않으므로 view 가 안정적
+  std::string_view store(std::string_view s);
+
+  mutable std::shared_mutex mu_;
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* cur_block_{nullptr};                          // 짧은 문자열을 이어 쓰는 현재 블록
+  std::size_t block_used_{0};
+  std::vector<std::string_view> views_;               // 심볼 id -> 문자열
+  std::unordered_map<std::string_view, std::uint32_t> index_;
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
+
+template <>
+struct std::hash<ROBIT_HUMANOID_MOTION_EDITOR::Symbol> {
+  std::size_t operator()(const ROBIT_HUMANOID_MOTION_EDITOR::Symbol& s) const noexcept {
+    return s.id;
+  }
+};
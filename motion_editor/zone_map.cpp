@@ -0,0 +1,234 @@
+/*
+ * Joint Zone Map
+ * @file zone_map.cpp
+ * Block summaries, incremental updates and block-skipping range queries.
+ * A joint listed twice in one frame counts once (first entry, same as editJoints).
+ */
+
+#include "motion_editor/zone_map.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <limits>
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+JointZoneMap::JointZoneMap() {
+  col_of_.fill(-1);
+}
+
+JointZoneMap::JointZoneMap(const JointZoneMap& other) {
+  std::lock_guard<std::mutex> lk(other.mu_);
+  frames_ = other.frames_;
+  col_of_ = other.col_of_;
+  cols_ = other.cols_; // 열은 공유, 수정 시 mutableZone 에서 분리
+  stats_ = other.stats_;
+  dirty_ = other.dirty_;
+  any_dirty_ = other.any_dirty_;
+}
+
+JointZoneMap::Zone JointZoneMap::emptyZone() {
+  return Zone{std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(), 0.0, 0};
+}
+
+std::shared_ptr<JointZoneMap::ZoneGroup> JointZoneMap::emptyGroup() {
+  auto g = std::make_shared<ZoneGroup>();
+  g->zones.fill(emptyZone());
+  return g;
+}
+
+void JointZoneMap::addToZone(Zone& z, double v) {
+  z.min = std::min(z.min, v);
+  z.max = std::max(z.max, v);
+  z.sum += v;
+  ++z.count;
+}
+
+bool JointZoneMap::sameZone(const Zone& a, const Zone& b) {
+  return a.count == b.count && a.min == b.min && a.max == b.max && a.sum == b.sum;
+}
+
+int JointZoneMap::ensureColumn(int id) const {
+  if (col_of_[id] >= 0) return col_of_[id];
+  // 기존 블록은 모두 빈 요약이므로 빈 묶음 하나를 공유
+  auto c = std::make_shared<Column>();
+  c->groups.assign((dirty_.size() + kGroupSize - 1) >> kGroupBits, emptyGroup());
+  cols_.push_back(std::move(c));
+  stats_.emplace_back();
+  col_of_[id] = (std::int16_t)(cols_.size() - 1);
+  return col_of_[id];
+}
+
+std::size_t JointZoneMap::blockFrames(std::size_t b) const {
+  return std::min(kBlockSize, frames_ - (b << kBlockBits));
+}
+
+const JointZoneMap::Zone& JointZoneMap::zoneAt(int col, std::size_t b) const {
+  return cols_[col]->groups[b >> kGroupBits]->zones[b & (kGroupSize - 1)];
+}
+
+JointZoneMap::Zone& JointZoneMap::mutableZone(int col, std::size_t b) const {
+  auto& c = cols_[col];
+  if (c.use_count() > 1) c = std::make_shared<Column>(*c);
+  auto& g = c->groups[b >> kGroupBits];
+  if (g.use_count() > 1) g = std::make_shared<ZoneGroup>(*g);
+  return g->zones[b & (kGroupSize - 1)];
+}
+
+void JointZoneMap::appendFrame(const Frame& f) {
+  std::lock_guard<std::mutex> lk(mu_);
+  const std::size_t b = frames_ >> kBlockBits;
+  if (b == dirty_.size()) {
+    dirty_.push_back(0);
+    if ((b & (kGroupSize - 1)) == 0) {
+      // 새 묶음: 아직 빈 요약이므로 열끼리 하나를 공유 (쓸 때 분리)
+      auto g = emptyGroup();
+      for (auto& c : cols_) {
+        if (c.use_count() > 1) c = std::make_shared<Column>(*c);
+        c->groups.push_back(g);
+      }
+    }
+  }
+  ++frames_;
+
+  std::bitset<kMaxMotorId + 1> seen;
+  for (const auto& dv : f.dxl) {
+    if (dv.id < 0 || dv.id > kMaxMotorId || seen.test(dv.id)) continue;
+    seen.set(dv.id);
+    const int col = ensureColumn(dv.id);
+    addToZone(mutableZone(col, b), dv.position);
+    stats_[col].valid = false;
+  }
+}
+
+void JointZoneMap::setValue(std::size_t frame, int id, double old_value, bool existed, double new_value) {
+  if (id < 0 || id > kMaxMotorId) return;
+  std::lock_guard<std::mutex> lk(mu_);
+  const std::size_t b = frame >> kBlockBits;
+  if (frame >= frames_ || dirty_[b]) return; // 어차피 재계산됨
+
+  const int col = ensureColumn(id);
+  stats_[col].valid = false;
+  if (existed) {
+    // 경계값이 안쪽으로 이동하면 블록의 새 경계를 알 수 없으므로 재계산 대상
+    const Zone& z = zoneAt(col, b);
+    if ((old_value <= z.min && new_value > old_value) || (old_value >= z.max && new_value < old_value)) {
+      dirty_[b] = 1;
+      any_dirty_ = true;
+      return;
+    }
+  }
+
+  Zone& z = mutableZone(col, b);
+  if (!existed) {
+    addToZone(z, new_value);
+    return;
+  }
+  z.sum += new_value - old_value;
+  z.min = std::min(z.min, new_value);
+  z.max = std::max(z.max, new_value);
+}
+
+void JointZoneMap::markDirty(std::size_t frame) {
+  std::lock_guard<std::mutex> lk(mu_);
+  if (frame >= frames_) return;
+  dirty_[frame >> kBlockBits] = 1;
+  any_dirty_ = true;
+}
+
+void JointZoneMap::rebuildBlock(const MotionEditor& me, std::size_t b) const {
+  // 새 요약을 따로 계산한 뒤 달라진 열만 기록 (같은 값이면 공유 유지)
+  std::vector<Zone> fresh(cols_.size(), emptyZone());
+  const std::size_t begin = b << kBlockBits;
+  const std::size_t end = begin + blockFrames(b);
+  for (std::size_t i = begin; i < end; ++i) {
+    std::bitset<kMaxMotorId + 1> seen;
+    for (const auto& dv : me.frameAt(i).dxl) {
+      if (dv.id < 0 || dv.id > kMaxMotorId || seen.test(dv.id)) continue;
+      seen.set(dv.id);
+      const std::size_t col = (std::size_t)ensureColumn(dv.id);
+      if (col == fresh.size()) fresh.push_back(emptyZone());
+      addToZone(fresh[col], dv.position);
+    }
+  }
+
+  for (std::size_t col = 0; col < fresh.size(); ++col) {
+    if (sameZone(zoneAt((int)col, b), fresh[col])) continue;
+    mutableZone((int)col, b) = fresh[col];
+    stats_[col].valid = false;
+  }
+  dirty_[b] = 0;
+}
+
+void JointZoneMap::refresh(const MotionEditor& me) const {
+  if (!any_dirty_) return;
+  for (std::size_t b = 0; b < dirty_.size(); ++b) {
+    if (dirty_[b]) rebuildBlock(me, b);
+  }
+  any_dirty_ = false;
+}
+
+JointStats JointZoneMap::stats(const MotionEditor& me, int id) const {
+  if (id < 0 || id > kMaxMotorId) return JointStats{};
+  std::lock_guard<std::mutex> lk(mu_);
+  refresh(me);
+  if (col_of_[id] < 0) return JointStats{};
+
+  const int col = col_of_[id];
+  ColumnStats& c = stats_[col];
+  if (!c.valid) {
+    // 블록 요약만 합침 (프레임 재방문 없음)
+    Zone all = emptyZone();
+    std::size_t count = 0;
+    for (std::size_t b = 0; b < dirty_.size(); ++b) {
+      const Zone& z = zoneAt(col, b);
+      if (z.count == 0) continue;
+      all.min = std::min(all.min, z.min);
+      all.max = std::max(all.max, z.max);
+      all.sum += z.sum;
+      count += z.count;
+    }
+    c.stats = JointStats{};
+    if (count > 0) {
+      c.stats.count = count;
+      c.stats.min = all.min;
+      c.stats.max = all.max;
+      c.stats.mean = all.sum / (double)count;
+      c.stats.range = all.max - all.min;
+    }
+    c.valid = true;
+  }
+  return c.stats;
+}
+
+void JointZoneMap::findFrames(const MotionEditor& me, int id, double lo, double hi,
+                              std::vector<std::size_t>& out) const {
+  out.clear();
+  if (id < 0 || id > kMaxMotorId || lo > hi) return;
+  std::lock_guard<std::mutex> lk(mu_);
+  refresh(me);
+  if (col_of_[id] < 0) return;
+
+  const int col = col_of_[id];
+  for (std::size_t b = 0; b < dirty_.size(); ++b) {
+    const Zone& z = zoneAt(col, b);
+    if (z.count == 0 || z.max < lo || z.min > hi) continue; // 블록 건너뜀
+
+    const std::size_t begin = b << kBlockBits;
+    const std::size_t n = blockFrames(b);
+    if (lo <= z.min && z.max <= hi && z.count == n) {
+      // 블록 전체가 조건을 만족 (모든 프레임에 관절 존재)
+      for (std::size_t i = begin; i < begin + n; ++i) out.push_back(i);
+      continue;
+    }
+    for (std::size_t i = begin; i < begin + n; ++i) {
+      for (const auto& dv : me.frameAt(i).dxl) {
+        if (dv.id != id) continue;
+        if (lo <= dv.position && dv.position <= hi) out.push_back(i);
+        break;
+      }
+    }
+  }
+}
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR
@@ -0,0 +1,101 @@
+/*
+ * Joint Zone Map
+ * @file zone_map.hpp
+ * Per-joint min/max/sum summaries over fixed 64-frame blocks, owned by MotionEditor.
+ *
+ * Key features:
+ * - Range queries ("frames where joint X is in [lo, hi]") skip blocks whose
+ *   [min, max] does not overlap and take whole blocks that lie fully inside
+ * - editJoints updates the summary in place; a value moving inward from a
+ *   block's min/max, or a raw mutableFrameAt access, marks the block dirty
+ *   and it is recomputed on the next query
+ * - Whole-motion per-joint stats (min, max, mean, range) are cached per joint
+ * - Columns and their 4-block groups are shared copy-on-write between editor
+ *   copies, like frame chunks, so an edit on a copy duplicates only the
+ *   touched column's group list and one block group
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "motion_editor/motion_editor.hpp"
+
+namespace ROBIT_HUMANOID_MOTION_EDITOR
+{
+class JointZoneMap {
+public:
+  static constexpr std::size_t kBlockBits = 6;
+  static constexpr std::size_t kBlockSize = std::size_t(1) << kBlockBits;
+
+  JointZoneMap();
+  // 편집기 복제본이 분리될 때 사용 (원본이 조회 중이어도 안전)
+  // 열/블록 묶음은 포인터만 복사하고 수정 시 분리
+  JointZoneMap(const JointZoneMap& other);
+  JointZoneMap& operator=(const JointZoneMap&) = delete;
+
+  // ===== 편집기 쪽 갱신 =====
+  // 프레임 추가 (인덱스 = 현재 프레임 수)
+  void appendFrame(const Frame& f);
+  // frame 의 관절 id 값 변경 (existed = 원래 프레임에 있던 관절)
+  void setValue(std::size_t frame, int id, double old_value, bool existed, double new_value);
+  // 알 수 없는 변경: 블록 전체를 다음 조회 때 재계산
+  void markDirty(std::size_t frame);
+
+  // ===== 조회 (me = 이 맵을 소유한 편집기) =====
+  JointStats stats(const MotionEditor& me, int id) const;
+  // lo <= position <= hi 인 프레임 인덱스 (오름차순)
+  void findFrames(const MotionEditor& me, int id, double lo, double hi,
+                  std::vector<std::size_t>& out) const;
+
+private:
+  // 블록 4개(256 프레임, 프레임 청크와 같은 크기)를 한 묶음으로 공유
+  static constexpr std::size_t kGroupBits = 2;
+  static constexpr std::size_t kGroupSize = std::size_t(1) << kGroupBits;
+
+  struct Zone {
+    double min;
+    double max;
+    double sum;
+    std::uint32_t count; // 블록 내 이 관절이 있는 프레임 수
+  };
+  struct ZoneGroup {
+    std::array<Zone, kGroupSize> zones;
+  };
+  struct Column {
+    std::vector<std::shared_ptr<ZoneGroup>> groups; // 블록 묶음별 (맵/열끼리 공유)
+  };
+  // 통계 캐시는 맵마다 따로 (열 데이터는 다른 편집기의 맵과 공유될 수 있으므로)
+  struct ColumnStats {
+    bool valid{false};
+    JointStats stats;
+  };
+
+  static Zone emptyZone();
+  static std::shared_ptr<ZoneGroup> emptyGroup();
+  static void addToZone(Zone& z, double v);
+  static bool sameZone(const Zone& a, const Zone& b);
+  int ensureColumn(int id) const;
+  std::size_t blockFrames(std::size_t b) const;
+  const Zone& zoneAt(int col, std::size_t b) const;
+  // 쓰기 전 분리: 공유 중인 열/블록 묶음만 복사
+  Zone& mutableZone(int col, std::size_t b) const;
+  // dirty 블록 재계산 (mu_ 잡은 상태에서 호출)
+  void refresh(const MotionEditor& me) const;
+  void rebuildBlock(const MotionEditor& me, std::size_t b) const;
+
+  mutable std::mutex mu_;
+  std::size_t frames_{0};
+  // 아래는 조회 시 지연 재계산되므로 mutable
+  mutable std::array<std::int16_t, kMaxMotorId + 1> col_of_; // 모터ID -> 열 (-1 = 없음)
+  mutable std::vector<std::shared_ptr<Column>> cols_;
+  mutable std::vector<ColumnStats> stats_;  // 열별
+  mutable std::vector<std::uint8_t> dirty_; // 블록별
+  mutable bool any_dirty_{false};
+};
+
+} // namespace ROBIT_HUMANOID_MOTION_EDITOR